@@ -0,0 +1,136 @@
+#pragma once
+#include "MemoryTracker.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+
+// ================= BENCHMARK HARNESS =================
+// Shared by the windowless benchmark executables. Allocation counts come
+// from MemoryTracker, so benchmarks are built with DSA_TRACK_MEMORY.
+namespace Bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Measurement
+    {
+        double nsPerOp = 0.0;       // best repetition
+        double allocsPerOp = 0.0;   // averaged over all repetitions
+        double bytesPerOp = 0.0;
+    };
+
+    inline volatile long long g_sink = 0;
+
+    // Keeps the optimiser from discarding benchmark results
+    inline void doNotOptimize(long long value)
+    {
+        g_sink = value;
+    }
+
+    struct AllocSnapshot
+    {
+        long long allocs;
+        long long bytes;
+
+        static AllocSnapshot take()
+        {
+            MemoryStats total = MemoryTracker::getTotal();
+            return { total.totalAllocs, total.totalBytes };
+        }
+    };
+
+    // setup() builds fresh state each repetition (untimed); op(state) is timed.
+    // opsPerRep is how many element operations one op() call performs.
+    template<typename Setup, typename Op>
+    Measurement measure(int opsPerRep, int reps, Setup setup, Op op)
+    {
+        Measurement m;
+        double best = 1e300;
+        long long allocs = 0;
+        long long bytes = 0;
+
+        for (int r = 0; r < reps; ++r)
+        {
+            auto state = setup();
+
+            AllocSnapshot before = AllocSnapshot::take();
+            Clock::time_point start = Clock::now();
+            op(state);
+            Clock::time_point end = Clock::now();
+            AllocSnapshot after = AllocSnapshot::take();
+
+            double ns = std::chrono::duration<double, std::nano>(end - start).count();
+            best = std::min(best, ns);
+            allocs += after.allocs - before.allocs;
+            bytes += after.bytes - before.bytes;
+        }
+
+        double ops = static_cast<double>(opsPerRep);
+        m.nsPerOp = best / ops;
+        m.allocsPerOp = static_cast<double>(allocs) / reps / ops;
+        m.bytesPerOp = static_cast<double>(bytes) / reps / ops;
+        return m;
+    }
+
+    // Repetitions so that each measurement touches roughly `budget` elements
+    inline int repsFor(int n, int budget)
+    {
+        return std::max(3, std::min(1000, budget / std::max(1, n)));
+    }
+
+    // Fraction of consecutive element addresses that skip past the next cache
+    // line: a cheap proxy for hardware cache misses during a linear walk.
+    class LineJumpCounter
+    {
+    public:
+        void visit(const void* address)
+        {
+            std::uintptr_t line = reinterpret_cast<std::uintptr_t>(address) / 64;
+            if (m_visited > 0 && line != m_lastLine && line != m_lastLine + 1)
+                m_jumps++;
+            m_lastLine = line;
+            m_visited++;
+        }
+
+        double percent() const
+        {
+            return m_visited > 1 ? 100.0 * m_jumps / (m_visited - 1) : 0.0;
+        }
+
+    private:
+        std::uintptr_t m_lastLine = 0;
+        long long m_visited = 0;
+        long long m_jumps = 0;
+    };
+
+    // ---------------- Output ----------------
+    inline bool& csvMode()
+    {
+        static bool csv = false;
+        return csv;
+    }
+
+    // Shared flags: --csv output, --memory-json <file> stats dump at exit
+    inline void parseArgs(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], "--csv") == 0)
+                csvMode() = true;
+            else if (std::strcmp(argv[i], "--memory-json") == 0 && i + 1 < argc)
+                MemoryTracker::setExitJson(argv[++i]);
+        }
+
+        if (!MemoryTracker::isEnabled())
+            std::fprintf(stderr, "[BENCH] Built without DSA_TRACK_MEMORY: allocation columns read 0\n");
+    }
+
+    inline bool hasFlag(int argc, char** argv, const char* flag)
+    {
+        for (int i = 1; i < argc; ++i)
+            if (std::strcmp(argv[i], flag) == 0)
+                return true;
+        return false;
+    }
+}
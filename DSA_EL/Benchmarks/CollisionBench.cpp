@@ -0,0 +1,534 @@
+// ================= COLLISION BENCHMARK =================
+// Broad-phase and narrow-phase collision code over synthetic scenes, no
+// window. Every broad phase runs the same two tasks on each scene:
+//   pairs   - build the structure and find every overlapping pair
+//   queries - player-sized box queries at random points
+// Narrow-phase rows time the individual overlap tests on pre-generated data,
+// including the exact spike test (SAT, with and without its bounds reject)
+// next to the box approximation it replaced. Platform rows step falling
+// bodies against the dash strip, against every platform and against the
+// rangeX window, to show the windowed cost staying flat as n grows.
+//
+//   CollisionBench [--csv] [--quick]
+//
+// Build from DSA_EL/DSA_EL sources plus MemoryTracker.cpp with
+// DSA_TRACK_MEMORY defined; links sfml-graphics.
+
+#include "BenchCommon.hpp"
+#include "Collision.hpp"
+#include "Physics.hpp"
+#include "QuadTree.hpp"
+#include "SpatialGrid.hpp"
+#include "DynamicArray.hpp"
+#include <SFML/Graphics.hpp>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    // ---------------- Scenes ----------------
+    struct Scene
+    {
+        const char* name;
+        sf::FloatRect area;
+        DynamicArray<sf::FloatRect> boxes;
+    };
+
+    Scene makeUniform(int n, std::mt19937& rng)
+    {
+        Scene s{ "uniform", { { 0.f, 0.f }, { 4000.f, 4000.f } }, {} };
+        std::uniform_real_distribution<float> pos(0.f, 3950.f);
+        std::uniform_real_distribution<float> size(20.f, 50.f);
+        for (int i = 0; i < n; ++i)
+            s.boxes.push_back({ { pos(rng), pos(rng) }, { size(rng), size(rng) } });
+        return s;
+    }
+
+    // Dense blobs around a few centres (crowds of enemies / particles)
+    Scene makeClustered(int n, std::mt19937& rng)
+    {
+        Scene s{ "clustered", { { 0.f, 0.f }, { 4000.f, 4000.f } }, {} };
+        std::uniform_real_distribution<float> centre(400.f, 3600.f);
+        std::normal_distribution<float> spread(0.f, 120.f);
+        std::uniform_real_distribution<float> size(20.f, 50.f);
+
+        sf::Vector2f centres[8];
+        for (int c = 0; c < 8; ++c)
+            centres[c] = { centre(rng), centre(rng) };
+
+        for (int i = 0; i < n; ++i)
+        {
+            sf::Vector2f c = centres[i % 8];
+            float x = std::clamp(c.x + spread(rng), 0.f, 3950.f);
+            float y = std::clamp(c.y + spread(rng), 0.f, 3950.f);
+            s.boxes.push_back({ { x, y }, { size(rng), size(rng) } });
+        }
+        return s;
+    }
+
+    // Dash-style obstacle strip: sorted by x, all on or near the ground line
+    Scene makeDashStrip(int n, std::mt19937& rng)
+    {
+        float length = n * 60.f;
+        Scene s{ "dash-strip", { { 0.f, 0.f }, { length + 100.f, 600.f } }, {} };
+        std::uniform_real_distribution<float> gap(30.f, 90.f);
+        std::uniform_real_distribution<float> height(30.f, 120.f);
+        float x = 0.f;
+        for (int i = 0; i < n; ++i)
+        {
+            float h = height(rng);
+            s.boxes.push_back({ { x, 480.f - h }, { 40.f, h } });
+            x += gap(rng);
+        }
+        return s;
+    }
+
+    DynamicArray<sf::FloatRect> makeQueries(const Scene& scene, int count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> qx(scene.area.position.x, scene.area.position.x + scene.area.size.x - 40.f);
+        std::uniform_real_distribution<float> qy(scene.area.position.y, scene.area.position.y + scene.area.size.y - 40.f);
+        DynamicArray<sf::FloatRect> queries;
+        for (int i = 0; i < count; ++i)
+            queries.push_back({ { qx(rng), qy(rng) }, { 40.f, 40.f } });
+        return queries;
+    }
+
+    // ---------------- Reporting ----------------
+    void printHeader()
+    {
+        if (Bench::csvMode())
+            std::printf("scene,n,impl,task,ms,ops_per_sec,result\n");
+        else
+            std::printf("%-11s %7s %-16s %-8s %10s %14s %10s\n", "scene", "n", "impl", "task", "ms", "ops/sec", "result");
+    }
+
+    void printRow(const char* scene, int n, const char* impl, const char* task, double ms, double ops, long long result)
+    {
+        double perSec = ms > 0.0 ? ops / (ms / 1000.0) : 0.0;
+        if (Bench::csvMode())
+            std::printf("%s,%d,%s,%s,%.3f,%.0f,%lld\n", scene, n, impl, task, ms, perSec, result);
+        else
+            std::printf("%-11s %7d %-16s %-8s %10.3f %14.0f %10lld\n", scene, n, impl, task, ms, perSec, result);
+    }
+
+    template<typename Fn>
+    double timeMs(Fn fn, long long& result)
+    {
+        double best = 1e300;
+        for (int r = 0; r < 3; ++r)
+        {
+            Bench::Clock::time_point start = Bench::Clock::now();
+            result = fn();
+            double ms = std::chrono::duration<double, std::milli>(Bench::Clock::now() - start).count();
+            best = std::min(best, ms);
+        }
+        return best;
+    }
+
+    // ---------------- Broad phases ----------------
+    long long pairsBruteForce(const Scene& s)
+    {
+        long long pairs = 0;
+        for (int i = 0; i < s.boxes.size(); ++i)
+            for (int j = i + 1; j < s.boxes.size(); ++j)
+                if (Collision::aabbOverlap(s.boxes[i], s.boxes[j]))
+                    pairs++;
+        return pairs;
+    }
+
+    // Sort by left edge, then only compare boxes whose x ranges overlap
+    long long pairsSweep(const Scene& s)
+    {
+        std::vector<int> order(s.boxes.size());
+        for (int i = 0; i < s.boxes.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            return s.boxes[a].position.x < s.boxes[b].position.x;
+        });
+
+        long long pairs = 0;
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            const sf::FloatRect& a = s.boxes[order[i]];
+            float right = a.position.x + a.size.x;
+            for (std::size_t j = i + 1; j < order.size() && s.boxes[order[j]].position.x < right; ++j)
+                if (Collision::aabbOverlap(a, s.boxes[order[j]]))
+                    pairs++;
+        }
+        return pairs;
+    }
+
+    long long pairsQuadTree(const Scene& s)
+    {
+        QuadTree tree(s.area);
+        for (int i = 0; i < s.boxes.size(); ++i)
+            tree.insert(i, s.boxes[i]);
+
+        long long pairs = 0;
+        DynamicArray<int> hits;
+        for (int i = 0; i < s.boxes.size(); ++i)
+        {
+            hits.clear();
+            tree.query(s.boxes[i], hits);
+            for (int k = 0; k < hits.size(); ++k)
+                if (hits[k] > i)
+                    pairs++;
+        }
+        return pairs;
+    }
+
+    long long pairsGrid(const Scene& s, float cellSize)
+    {
+        SpatialGrid grid(s.area, cellSize);
+        for (int i = 0; i < s.boxes.size(); ++i)
+            grid.insert(s.boxes[i]);
+
+        long long pairs = 0;
+        DynamicArray<int> hits;
+        for (int i = 0; i < s.boxes.size(); ++i)
+        {
+            hits.clear();
+            grid.query(s.boxes[i], hits);
+            for (int k = 0; k < hits.size(); ++k)
+                if (hits[k] > i)
+                    pairs++;
+        }
+        return pairs;
+    }
+
+    void benchBroadPhase(const Scene& s, const DynamicArray<sf::FloatRect>& queries, bool quick)
+    {
+        int n = s.boxes.size();
+        long long reference = -1;
+        long long result = 0;
+        double ms = 0.0;
+
+        auto check = [&](const char* impl) {
+            if (reference < 0)
+                reference = result;
+            else if (result != reference)
+                std::fprintf(stderr, "[BENCH] %s on %s found %lld pairs, expected %lld\n", impl, s.name, result, reference);
+        };
+
+        // ---- pairs ----
+        if (n <= (quick ? 5000 : 20000))
+        {
+            ms = timeMs([&] { return pairsBruteForce(s); }, result);
+            printRow(s.name, n, "brute-force", "pairs", ms, n, result);
+            check("brute-force");
+        }
+
+        ms = timeMs([&] { return pairsSweep(s); }, result);
+        printRow(s.name, n, "sort-and-sweep", "pairs", ms, n, result);
+        check("sort-and-sweep");
+
+        ms = timeMs([&] { return pairsQuadTree(s); }, result);
+        printRow(s.name, n, "quadtree", "pairs", ms, n, result);
+        check("quadtree");
+
+        ms = timeMs([&] { return pairsGrid(s, 64.f); }, result);
+        printRow(s.name, n, "grid(64)", "pairs", ms, n, result);
+        check("grid(64)");
+
+        ms = timeMs([&] { return pairsGrid(s, 256.f); }, result);
+        printRow(s.name, n, "grid(256)", "pairs", ms, n, result);
+        check("grid(256)");
+
+        // ---- queries (structures built once, untimed) ----
+        int q = queries.size();
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < q; ++i)
+                for (int j = 0; j < n; ++j)
+                    if (Collision::aabbOverlap(queries[i], s.boxes[j]))
+                        hits++;
+            return hits;
+        }, result);
+        printRow(s.name, n, "brute-force", "queries", ms, q, result);
+
+        // Sorted-by-x window scan, the way Dash walks its obstacle stream
+        std::vector<int> order(n);
+        for (int i = 0; i < n; ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](int a, int b) { return s.boxes[a].position.x < s.boxes[b].position.x; });
+        std::vector<float> sortedX(n);
+        float maxWidth = 0.f;
+        for (int i = 0; i < n; ++i)
+        {
+            sortedX[i] = s.boxes[order[i]].position.x;
+            maxWidth = std::max(maxWidth, s.boxes[order[i]].size.x);
+        }
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < q; ++i)
+            {
+                const sf::FloatRect& area = queries[i];
+                auto first = std::lower_bound(sortedX.begin(), sortedX.end(), area.position.x - maxWidth);
+                for (auto it = first; it != sortedX.end() && *it < area.position.x + area.size.x; ++it)
+                    if (Collision::aabbOverlap(area, s.boxes[order[it - sortedX.begin()]]))
+                        hits++;
+            }
+            return hits;
+        }, result);
+        printRow(s.name, n, "sorted-x window", "queries", ms, q, result);
+
+        QuadTree tree(s.area);
+        for (int i = 0; i < n; ++i)
+            tree.insert(i, s.boxes[i]);
+        DynamicArray<int> hitList;
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < q; ++i)
+            {
+                hitList.clear();
+                tree.query(queries[i], hitList);
+                hits += hitList.size();
+            }
+            return hits;
+        }, result);
+        printRow(s.name, n, "quadtree", "queries", ms, q, result);
+
+        SpatialGrid grid(s.area, 64.f);
+        for (int i = 0; i < n; ++i)
+            grid.insert(s.boxes[i]);
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < q; ++i)
+            {
+                hitList.clear();
+                grid.query(queries[i], hitList);
+                hits += hitList.size();
+            }
+            return hits;
+        }, result);
+        printRow(s.name, n, "grid(64)", "queries", ms, q, result);
+    }
+
+    // ---------------- Platform physics ----------------
+    // Each query box falls and runs right by one 60 Hz step; result counts
+    // landings plus side hits, so both rows must agree
+    void benchPlatforms(const Scene& s, const DynamicArray<sf::FloatRect>& queries)
+    {
+        DynamicArray<Physics::Platform> platforms;
+        float maxWidth = 0.f;
+        for (int i = 0; i < s.boxes.size(); ++i)
+        {
+            platforms.push_back({ s.boxes[i] });
+            maxWidth = std::max(maxWidth, s.boxes[i].size.x);
+        }
+
+        const sf::Vector2f step(9.f, 12.f);
+        auto contacts = [](const Physics::Contacts& c) { return (c.grounded() ? 1 : 0) + (c.wall >= 0 ? 1 : 0); };
+        int n = s.boxes.size();
+        long long result = 0;
+        double ms = 0.0;
+
+        if (n <= 10000)
+        {
+            ms = timeMs([&] {
+                long long hits = 0;
+                for (int i = 0; i < queries.size(); ++i)
+                {
+                    sf::FloatRect to(queries[i].position + step, queries[i].size);
+                    sf::Vector2f velocity = step;
+                    hits += contacts(Physics::resolve(queries[i], to, velocity, platforms.data(), n));
+                }
+                return hits;
+            }, result);
+            printRow(s.name, n, "resolve all", "steps", ms, queries.size(), result);
+        }
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < queries.size(); ++i)
+            {
+                const sf::FloatRect& from = queries[i];
+                sf::FloatRect to(from.position + step, from.size);
+                sf::Vector2f velocity = step;
+                int begin = 0, end = 0;
+                Physics::rangeX(platforms.data(), n, from.position.x, to.position.x + to.size.x, maxWidth, begin, end);
+                hits += contacts(Physics::resolve(from, to, velocity, platforms.data() + begin, end - begin));
+            }
+            return hits;
+        }, result);
+        printRow(s.name, n, "rangeX+resolve", "steps", ms, queries.size(), result);
+    }
+
+    // ---------------- Narrow phase ----------------
+    // The sqrt/pow distance test the original Survival loop used
+    bool legacyCircleCheck(sf::Vector2f a, float ra, sf::Vector2f b, float rb)
+    {
+        float distance = std::sqrt(std::pow(a.x - b.x, 2.f) + std::pow(a.y - b.y, 2.f));
+        return distance < ra + rb;
+    }
+
+    void benchNarrowPhase(int count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> pos(0.f, 400.f);
+        std::uniform_real_distribution<float> size(10.f, 60.f);
+
+        DynamicArray<sf::FloatRect> a, b;
+        DynamicArray<Collision::WorldCollider> wa, wb;
+        for (int i = 0; i < count; ++i)
+        {
+            a.push_back({ { pos(rng), pos(rng) }, { size(rng), size(rng) } });
+            b.push_back({ { pos(rng), pos(rng) }, { size(rng), size(rng) } });
+
+            Transform t;
+            t.position = { pos(rng), pos(rng) };
+            wa.push_back(Collision::toWorld(t, (i & 1) ? Collider::box({ 0.f, 0.f }, { 30.f, 30.f }) : Collider::circle({ 0.f, 0.f }, 25.f)));
+            t.position = { pos(rng), pos(rng) };
+            wb.push_back(Collision::toWorld(t, (i & 2) ? Collider::box({ 0.f, 0.f }, { 30.f, 30.f }) : Collider::circle({ 0.f, 0.f }, 25.f)));
+        }
+
+        long long result = 0;
+        double ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+                hits += Collision::aabbOverlap(a[i], b[i]);
+            return hits;
+        }, result);
+        printRow("narrow", count, "aabbOverlap", "tests", ms, count, result);
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+                hits += Collision::circleOverlap(a[i].position, a[i].size.x, b[i].position, b[i].size.x);
+            return hits;
+        }, result);
+        printRow("narrow", count, "circle (squared)", "tests", ms, count, result);
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+                hits += legacyCircleCheck(a[i].position, a[i].size.x, b[i].position, b[i].size.x);
+            return hits;
+        }, result);
+        printRow("narrow", count, "circle sqrt/pow", "tests", ms, count, result);
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+                hits += Collision::boxCircleOverlap(a[i], b[i].position, b[i].size.x);
+            return hits;
+        }, result);
+        printRow("narrow", count, "boxCircle", "tests", ms, count, result);
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+                hits += Collision::overlaps(wa[i], wb[i]);
+            return hits;
+        }, result);
+        printRow("narrow", count, "overlaps (mixed)", "tests", ms, count, result);
+
+        // Exact spike test: triangle vs rotated square, as Dash runs it. Half
+        // the pairs are within touching range, half anywhere in the area
+        const sf::Vector2f spikePoints[3] = { { 0.f, 0.f }, { 20.f, -40.f }, { 40.f, 0.f } };
+        Hull spike = Hull::polygon(spikePoints, 3);
+        Hull square = Hull::box({ -20.f, -20.f }, { 40.f, 40.f });
+        std::uniform_real_distribution<float> near(-40.f, 40.f);
+        std::uniform_real_distribution<float> angle(0.f, 360.f);
+        DynamicArray<Transform> spikePoses, squarePoses;
+        DynamicArray<Collision::WorldHull> ha, hb;
+        for (int i = 0; i < count; ++i)
+        {
+            Transform s;
+            s.position = { pos(rng), pos(rng) };
+            Transform q;
+            q.position = (i & 1) ? sf::Vector2f(pos(rng), pos(rng))
+                                 : s.position + sf::Vector2f(20.f + near(rng), -20.f + near(rng));
+            q.rotation = angle(rng);
+            spikePoses.push_back(s);
+            squarePoses.push_back(q);
+            ha.push_back(Collision::toWorld(s, spike));
+            hb.push_back(Collision::toWorld(q, square));
+        }
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+                hits += static_cast<long long>(Collision::toWorld(squarePoses[i], square).bounds.position.x);
+            return hits;
+        }, result);
+        printRow("narrow", count, "hull toWorld", "tests", ms, count, result);
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+                hits += Collision::hullOverlap(ha[i], hb[i]);
+            return hits;
+        }, result);
+        printRow("narrow", count, "hullOverlap", "tests", ms, count, result);
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+                hits += !Collision::hasSeparatingAxis(ha[i], hb[i]) && !Collision::hasSeparatingAxis(hb[i], ha[i]);
+            return hits;
+        }, result);
+        printRow("narrow", count, "SAT no reject", "tests", ms, count, result);
+
+        // Old approximation: inset spike box vs unrotated shrunk player box
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                sf::FloatRect spikeBox(spikePoses[i].position + sf::Vector2f(8.f, -35.f), { 24.f, 35.f });
+                sf::FloatRect playerBox(squarePoses[i].position - sf::Vector2f(15.f, 15.f), { 30.f, 30.f });
+                hits += Collision::aabbOverlap(spikeBox, playerBox);
+            }
+            return hits;
+        }, result);
+        printRow("narrow", count, "spike box (old)", "tests", ms, count, result);
+
+        // Platform step: one body swept against one 120x20 platform
+        std::uniform_real_distribution<float> fall(0.f, 20.f);
+        DynamicArray<Physics::Platform> platforms;
+        DynamicArray<sf::Vector2f> steps;
+        for (int i = 0; i < count; ++i)
+        {
+            platforms.push_back({ { b[i].position, { 120.f, 20.f } } });
+            steps.push_back({ 9.f, fall(rng) });
+        }
+
+        ms = timeMs([&] {
+            long long hits = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                sf::FloatRect to(a[i].position + steps[i], a[i].size);
+                sf::Vector2f velocity = steps[i];
+                hits += Physics::resolve(a[i], to, velocity, &platforms[i], 1).grounded();
+            }
+            return hits;
+        }, result);
+        printRow("narrow", count, "Physics::resolve", "steps", ms, count, result);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Bench::parseArgs(argc, argv);
+    bool quick = Bench::hasFlag(argc, argv, "--quick");
+
+    std::mt19937 rng(1234);
+    printHeader();
+
+    const int sizes[] = { 1000, 10000, 50000 };
+    const int sizeCount = quick ? 2 : 3;
+    const int queryCount = quick ? 2000 : 10000;
+
+    for (int si = 0; si < sizeCount; ++si)
+    {
+        Scene scenes[3] = { makeUniform(sizes[si], rng), makeClustered(sizes[si], rng), makeDashStrip(sizes[si], rng) };
+        for (Scene& s : scenes)
+            benchBroadPhase(s, makeQueries(s, queryCount, rng), quick);
+        benchPlatforms(scenes[2], makeQueries(scenes[2], queryCount, rng));
+    }
+
+    benchNarrowPhase(quick ? 200000 : 1000000, rng);
+    return 0;
+}
@@ -0,0 +1,394 @@
+// ================= CONTAINER BENCHMARK =================
+// Custom containers (DynamicArray, Queue, Stack, LinkedList) against their
+// standard-library counterparts. No window; prints one row per
+// container/operation/element type/size.
+//
+//   ContainerBench [--csv] [--quick]
+//
+// Build from DSA_EL/DSA_EL sources plus MemoryTracker.cpp with
+// DSA_TRACK_MEMORY defined; links sfml-graphics (ShapeParticle, ConvexShape).
+//
+// ns/op is the best repetition divided by element count. allocs/op and
+// B/op come from MemoryTracker. jump% is the share of consecutive elements
+// more than one cache line apart while iterating (cache-miss proxy).
+
+#include "BenchCommon.hpp"
+#include "DynamicArray.hpp"
+#include "Queue.hpp"
+#include "Stack.hpp"
+#include "LinkedList.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <deque>
+#include <stack>
+#include <forward_list>
+#include <memory>
+
+namespace
+{
+    // ---------------- Element types ----------------
+    struct Blob64
+    {
+        int values[16];
+    };
+
+    // One particle as a self-drawing object (shape plus motion and fade
+    // state), the array-of-structs layout ParticleSystem moved away from
+    struct ShapeParticle
+    {
+        sf::CircleShape shape;
+        sf::Vector2f velocity;
+        float lifetime = 0.f;
+        float maxLifetime = 1.f;
+        sf::Color startColor;
+        sf::Color endColor;
+    };
+
+    template<typename T> T makeElement(int i);
+
+    template<> int makeElement<int>(int i) { return i; }
+
+    template<> Blob64 makeElement<Blob64>(int i)
+    {
+        Blob64 b;
+        for (int k = 0; k < 16; ++k)
+            b.values[k] = i + k;
+        return b;
+    }
+
+    template<> ShapeParticle makeElement<ShapeParticle>(int i)
+    {
+        ShapeParticle p;
+        p.shape.setRadius(3.f);
+        p.shape.setPosition({ static_cast<float>(i), 0.f });
+        p.velocity = { 1.f, 1.f };
+        p.startColor = sf::Color::White;
+        p.endColor = sf::Color::Transparent;
+        return p;
+    }
+
+    template<> sf::ConvexShape makeElement<sf::ConvexShape>(int i)
+    {
+        sf::ConvexShape shape(5);
+        for (std::size_t k = 0; k < 5; ++k)
+            shape.setPoint(k, { static_cast<float>(k * 10), static_cast<float>((k * 7) % 13) });
+        shape.setPosition({ static_cast<float>(i), 0.f });
+        return shape;
+    }
+
+    int key(int v) { return v; }
+    int key(const Blob64& b) { return b.values[0]; }
+    int key(const ShapeParticle& p) { return static_cast<int>(p.shape.getPosition().x); }
+    int key(const sf::ConvexShape& s) { return static_cast<int>(s.getPosition().x); }
+
+    // Cull keeps every other element, like particles expiring
+    template<typename T>
+    bool survives(const T& v) { return (key(v) & 1) == 0; }
+
+    // ---------------- Reporting ----------------
+    void printHeader()
+    {
+        if (Bench::csvMode())
+            std::printf("container,op,type,n,ns_per_op,allocs_per_op,bytes_per_op,line_jump_pct\n");
+        else
+            std::printf("%-22s %-8s %-12s %9s %11s %10s %10s %7s\n",
+                "container", "op", "type", "n", "ns/op", "allocs/op", "B/op", "jump%");
+    }
+
+    void printRow(const char* container, const char* op, const char* type, int n,
+        const Bench::Measurement& m, double jumpPct = -1.0)
+    {
+        if (Bench::csvMode())
+        {
+            std::printf("%s,%s,%s,%d,%.3f,%.4f,%.2f,", container, op, type, n, m.nsPerOp, m.allocsPerOp, m.bytesPerOp);
+            if (jumpPct >= 0.0) std::printf("%.1f\n", jumpPct); else std::printf("\n");
+        }
+        else
+        {
+            std::printf("%-22s %-8s %-12s %9d %11.3f %10.4f %10.2f ", container, op, type, n, m.nsPerOp, m.allocsPerOp, m.bytesPerOp);
+            if (jumpPct >= 0.0) std::printf("%7.1f\n", jumpPct); else std::printf("%7s\n", "-");
+        }
+    }
+
+    // In-place compaction: survivors are moved down in order (as remove_if does), no temporary array
+    template<typename T>
+    void cull(DynamicArray<T>& c)
+    {
+        int alive = 0;
+        for (int i = 0; i < c.size(); ++i)
+        {
+            if (survives(c[i]))
+            {
+                if (alive != i)
+                    c[alive] = std::move(c[i]);
+                alive++;
+            }
+        }
+        c.truncate(alive);
+    }
+
+    template<typename T>
+    void cull(std::vector<T>& c)
+    {
+        c.erase(std::remove_if(c.begin(), c.end(), [](const T& v) { return !survives(v); }), c.end());
+    }
+
+    // ---------------- Sequence containers ----------------
+    // DynamicArray and std::vector share the same operation set
+    template<typename Container, typename T>
+    void benchSequence(const char* name, const char* type, int n, int budget)
+    {
+        int reps = Bench::repsFor(n, budget);
+        auto filled = [n]() {
+            Container c;
+            for (int i = 0; i < n; ++i)
+                c.push_back(makeElement<T>(i));
+            return c;
+        };
+
+        T proto = makeElement<T>(0);
+        printRow(name, "push", type, n, Bench::measure(n, reps,
+            [] { return Container(); },
+            [&](Container& c) { for (int i = 0; i < n; ++i) c.push_back(proto); }));
+
+        printRow(name, "pop", type, n, Bench::measure(n, reps, filled,
+            [n](Container& c) { for (int i = 0; i < n; ++i) c.pop_back(); }));
+
+        Bench::LineJumpCounter jumps;
+        {
+            Container c = filled();
+            for (int i = 0; i < n; ++i)
+                jumps.visit(&c[i]);
+        }
+        printRow(name, "iterate", type, n, Bench::measure(n, reps, filled,
+            [n](Container& c) {
+                long long sum = 0;
+                for (int i = 0; i < n; ++i)
+                    sum += key(c[i]);
+                Bench::doNotOptimize(sum);
+            }), jumps.percent());
+
+        printRow(name, "copy", type, n, Bench::measure(n, reps, filled,
+            [](Container& c) { Container copy(c); Bench::doNotOptimize(copy.size()); }));
+
+        printRow(name, "cull", type, n, Bench::measure(n, reps, filled,
+            [](Container& c) { cull(c); }));
+    }
+
+    // ---------------- FIFO: Queue vs std::deque ----------------
+    template<typename T, int N>
+    void benchFifo(const char* type, int budget)
+    {
+        int reps = Bench::repsFor(N, budget);
+        T proto = makeElement<T>(0);
+
+        using Fixed = Queue<T, N>;
+        auto fixedFilled = [] {
+            auto q = std::make_unique<Fixed>();
+            for (int i = 0; i < N; ++i)
+                q->push(makeElement<T>(i));
+            return q;
+        };
+
+        printRow("Queue", "push", type, N, Bench::measure(N, reps,
+            [] { return std::make_unique<Fixed>(); },
+            [&](std::unique_ptr<Fixed>& q) { for (int i = 0; i < N; ++i) q->push(proto); }));
+        printRow("Queue", "pop", type, N, Bench::measure(N, reps, fixedFilled,
+            [](std::unique_ptr<Fixed>& q) { T out; for (int i = 0; i < N; ++i) q->pop(out); }));
+        printRow("Queue", "copy", type, N, Bench::measure(N, reps, fixedFilled,
+            [](std::unique_ptr<Fixed>& q) { auto copy = std::make_unique<Fixed>(*q); Bench::doNotOptimize(copy->empty()); }));
+
+        auto dequeFilled = [] {
+            std::deque<T> d;
+            for (int i = 0; i < N; ++i)
+                d.push_back(makeElement<T>(i));
+            return d;
+        };
+
+        printRow("std::deque", "push", type, N, Bench::measure(N, reps,
+            [] { return std::deque<T>(); },
+            [&](std::deque<T>& d) { for (int i = 0; i < N; ++i) d.push_back(proto); }));
+        printRow("std::deque", "pop", type, N, Bench::measure(N, reps, dequeFilled,
+            [](std::deque<T>& d) { for (int i = 0; i < N; ++i) d.pop_front(); }));
+
+        Bench::LineJumpCounter jumps;
+        {
+            std::deque<T> d = dequeFilled();
+            for (const T& v : d)
+                jumps.visit(&v);
+        }
+        printRow("std::deque", "iterate", type, N, Bench::measure(N, reps, dequeFilled,
+            [](std::deque<T>& d) {
+                long long sum = 0;
+                for (const T& v : d)
+                    sum += key(v);
+                Bench::doNotOptimize(sum);
+            }), jumps.percent());
+        printRow("std::deque", "copy", type, N, Bench::measure(N, reps, dequeFilled,
+            [](std::deque<T>& d) { std::deque<T> copy(d); Bench::doNotOptimize(static_cast<long long>(copy.size())); }));
+    }
+
+    // ---------------- LIFO: Stack vs std::stack ----------------
+    template<typename T, int N>
+    void benchLifo(const char* type, int budget)
+    {
+        int reps = Bench::repsFor(N, budget);
+        T proto = makeElement<T>(0);
+
+        using Fixed = Stack<T, N>;
+        auto fixedFilled = [] {
+            auto s = std::make_unique<Fixed>();
+            for (int i = 0; i < N; ++i)
+                s->push(makeElement<T>(i));
+            return s;
+        };
+
+        printRow("Stack", "push", type, N, Bench::measure(N, reps,
+            [] { return std::make_unique<Fixed>(); },
+            [&](std::unique_ptr<Fixed>& s) { for (int i = 0; i < N; ++i) s->push(proto); }));
+        printRow("Stack", "pop", type, N, Bench::measure(N, reps, fixedFilled,
+            [](std::unique_ptr<Fixed>& s) { T out; for (int i = 0; i < N; ++i) s->pop(out); }));
+        printRow("Stack", "copy", type, N, Bench::measure(N, reps, fixedFilled,
+            [](std::unique_ptr<Fixed>& s) { auto copy = std::make_unique<Fixed>(*s); Bench::doNotOptimize(copy->empty()); }));
+
+        auto stdFilled = [] {
+            std::stack<T> s;
+            for (int i = 0; i < N; ++i)
+                s.push(makeElement<T>(i));
+            return s;
+        };
+
+        printRow("std::stack", "push", type, N, Bench::measure(N, reps,
+            [] { return std::stack<T>(); },
+            [&](std::stack<T>& s) { for (int i = 0; i < N; ++i) s.push(proto); }));
+        printRow("std::stack", "pop", type, N, Bench::measure(N, reps, stdFilled,
+            [](std::stack<T>& s) { for (int i = 0; i < N; ++i) s.pop(); }));
+        printRow("std::stack", "copy", type, N, Bench::measure(N, reps, stdFilled,
+            [](std::stack<T>& s) { std::stack<T> copy(s); Bench::doNotOptimize(static_cast<long long>(copy.size())); }));
+    }
+
+    // ---------------- Lists: LinkedList vs std::forward_list ----------------
+    template<typename List, typename T>
+    void benchLinkedList(const char* name, const char* type, int n, int budget)
+    {
+        int reps = Bench::repsFor(n, budget);
+        T proto = makeElement<T>(0);
+        auto filled = [n] {
+            auto l = std::make_unique<List>();
+            for (int i = 0; i < n; ++i)
+                l->push_front(makeElement<T>(i));
+            return l;
+        };
+
+        printRow(name, "push", type, n, Bench::measure(n, reps,
+            [] { return std::make_unique<List>(); },
+            [&](std::unique_ptr<List>& l) { for (int i = 0; i < n; ++i) l->push_front(proto); }));
+        printRow(name, "pop", type, n, Bench::measure(n, reps, filled,
+            [n](std::unique_ptr<List>& l) { T out; for (int i = 0; i < n; ++i) l->pop_front(out); }));
+
+        Bench::LineJumpCounter jumps;
+        {
+            auto l = filled();
+            for (Node<T>* node = l->getHead(); node; node = node->next)
+                jumps.visit(node);
+        }
+        printRow(name, "iterate", type, n, Bench::measure(n, reps, filled,
+            [](std::unique_ptr<List>& l) {
+                long long sum = 0;
+                for (Node<T>* node = l->getHead(); node; node = node->next)
+                    sum += key(node->data);
+                Bench::doNotOptimize(sum);
+            }), jumps.percent());
+        // LinkedList is move-only and has no erase: copy/cull not applicable
+    }
+
+    template<typename T>
+    void benchForwardList(const char* type, int n, int budget)
+    {
+        int reps = Bench::repsFor(n, budget);
+        T proto = makeElement<T>(0);
+        auto filled = [n] {
+            std::forward_list<T> l;
+            for (int i = 0; i < n; ++i)
+                l.push_front(makeElement<T>(i));
+            return l;
+        };
+
+        printRow("std::forward_list", "push", type, n, Bench::measure(n, reps,
+            [] { return std::forward_list<T>(); },
+            [&](std::forward_list<T>& l) { for (int i = 0; i < n; ++i) l.push_front(proto); }));
+        printRow("std::forward_list", "pop", type, n, Bench::measure(n, reps, filled,
+            [n](std::forward_list<T>& l) { for (int i = 0; i < n; ++i) l.pop_front(); }));
+
+        Bench::LineJumpCounter jumps;
+        {
+            std::forward_list<T> l = filled();
+            for (const T& v : l)
+                jumps.visit(&v);
+        }
+        printRow("std::forward_list", "iterate", type, n, Bench::measure(n, reps, filled,
+            [](std::forward_list<T>& l) {
+                long long sum = 0;
+                for (const T& v : l)
+                    sum += key(v);
+                Bench::doNotOptimize(sum);
+            }), jumps.percent());
+        printRow("std::forward_list", "copy", type, n, Bench::measure(n, reps, filled,
+            [](std::forward_list<T>& l) { std::forward_list<T> copy(l); Bench::doNotOptimize(copy.empty()); }));
+        printRow("std::forward_list", "cull", type, n, Bench::measure(n, reps, filled,
+            [](std::forward_list<T>& l) { l.remove_if([](const T& v) { return !survives(v); }); }));
+    }
+
+    // ---------------- One element type at one size ----------------
+    template<typename T, int N>
+    void benchSize(const char* type, int budget)
+    {
+        benchSequence<DynamicArray<T>, T>("DynamicArray", type, N, budget);
+        benchSequence<std::vector<T>, T>("std::vector", type, N, budget);
+        benchFifo<T, N>(type, budget);
+        benchLifo<T, N>(type, budget);
+        benchLinkedList<LinkedList<T>, T>("LinkedList(pool)", type, N, budget);
+        benchLinkedList<LinkedList<T, HeapAllocator<Node<T>>>, T>("LinkedList(heap)", type, N, budget);
+        benchForwardList<T>(type, N, budget);
+    }
+
+    template<typename T>
+    void benchLight(const char* type, bool quick)
+    {
+        const int budget = quick ? 200000 : 2000000;
+        benchSize<T, 10>(type, budget);
+        benchSize<T, 100>(type, budget);
+        benchSize<T, 1000>(type, budget);
+        benchSize<T, 10000>(type, budget);
+        benchSize<T, 100000>(type, budget);
+        if (!quick)
+            benchSize<T, 1000000>(type, budget);
+    }
+
+    // Heavy element types stop at 10k: the fixed-size Queue/Stack construct
+    // every slot up front, so larger sizes mostly measure their constructors
+    template<typename T>
+    void benchHeavy(const char* type, bool quick)
+    {
+        const int budget = quick ? 20000 : 200000;
+        benchSize<T, 10>(type, budget);
+        benchSize<T, 100>(type, budget);
+        benchSize<T, 1000>(type, budget);
+        if (!quick)
+            benchSize<T, 10000>(type, budget);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Bench::parseArgs(argc, argv);
+    bool quick = Bench::hasFlag(argc, argv, "--quick");
+
+    printHeader();
+    benchLight<int>("int", quick);
+    benchLight<Blob64>("Blob64", quick);
+    benchHeavy<ShapeParticle>("Particle", quick);
+    benchHeavy<sf::ConvexShape>("ConvexShape", quick);
+
+    return 0;
+}
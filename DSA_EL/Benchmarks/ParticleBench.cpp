@@ -0,0 +1,138 @@
+// ================= PARTICLE BENCHMARK =================
+// ParticleSystem update and vertex generation at a fixed population, no
+// window, on thread pools of 1, 2, 4 and 8 threads. Each frame tops the
+// system back up to the target count (untimed), then times update() and
+// submit() into a ParticleBatch; the first second is warm-up so lifetimes
+// are spread and every frame compacts out a share of dead particles.
+//
+//   ParticleBench [--csv] [--quick] [--count N]
+//
+// Build from DSA_EL/DSA_EL sources plus MemoryTracker.cpp with
+// DSA_TRACK_MEMORY defined; links sfml-graphics (sf::Vertex, sf::Color).
+//
+// speedup is against the 1-thread row; ideal scaling needs as many
+// hardware threads as the pool has.
+
+#include "BenchCommon.hpp"
+#include "Particles.hpp"
+#include "Effects.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdlib>
+#include <thread>
+
+namespace
+{
+    constexpr float TICK = 1.f / 60.f;
+    constexpr int WARMUP_FRAMES = 60;
+
+    struct Row
+    {
+        int threads = 0;
+        double updateMs = 0.0;      // per frame, best of the timed frames
+        double submitMs = 0.0;
+        long long allocs = 0;       // over all timed frames
+    };
+
+    void printHeader(int count)
+    {
+        if (Bench::csvMode())
+        {
+            std::printf("particles,threads,update_ms,submit_ms,frame_ms,mparticles_per_sec,speedup,allocs\n");
+            return;
+        }
+        std::printf("[BENCH] %d particles, chunk %d, %u hardware threads\n",
+            count, ParticleSystem::CHUNK_SIZE, std::thread::hardware_concurrency());
+        std::printf("%9s %7s %10s %10s %10s %12s %8s %7s\n",
+            "particles", "threads", "update ms", "submit ms", "frame ms", "Mpart/sec", "speedup", "allocs");
+    }
+
+    void printRow(int count, const Row& row, double baselineMs)
+    {
+        double frameMs = row.updateMs + row.submitMs;
+        double perSec = frameMs > 0.0 ? count / frameMs / 1000.0 : 0.0;
+        double speedup = frameMs > 0.0 ? baselineMs / frameMs : 0.0;
+
+        if (Bench::csvMode())
+            std::printf("%d,%d,%.3f,%.3f,%.3f,%.1f,%.2f,%lld\n",
+                count, row.threads, row.updateMs, row.submitMs, frameMs, perSec, speedup, row.allocs);
+        else
+            std::printf("%9d %7d %10.3f %10.3f %10.3f %12.1f %7.2fx %7lld\n",
+                count, row.threads, row.updateMs, row.submitMs, frameMs, perSec, speedup, row.allocs);
+    }
+
+    void topUp(ParticleSystem& particles, int emitter, int count)
+    {
+        int missing = count - particles.size();
+        if (missing > 0)
+            particles.burst(emitter, { 0.f, 0.f }, missing);
+    }
+
+    Row run(int threads, int count, int frames)
+    {
+        std::srand(1234);               // Same population for every pool size
+        ThreadPool pool(threads);
+        ParticleSystem particles(count, pool);
+        int emitter = particles.addEmitter(Effects::pop(sf::Color::Yellow, 0));
+        ParticleBatch batch;
+        batch.reserve(count);
+
+        for (int f = 0; f < WARMUP_FRAMES; ++f)
+        {
+            topUp(particles, emitter, count);
+            particles.update(TICK);
+            particles.submit(batch);
+        }
+
+        Row row;
+        row.threads = threads;
+        row.updateMs = 1e300;
+        row.submitMs = 1e300;
+        long long checksum = 0;
+
+        for (int f = 0; f < frames; ++f)
+        {
+            topUp(particles, emitter, count);
+
+            Bench::AllocSnapshot before = Bench::AllocSnapshot::take();
+            Bench::Clock::time_point t0 = Bench::Clock::now();
+            particles.update(TICK);
+            Bench::Clock::time_point t1 = Bench::Clock::now();
+            particles.submit(batch);
+            Bench::Clock::time_point t2 = Bench::Clock::now();
+            Bench::AllocSnapshot after = Bench::AllocSnapshot::take();
+
+            row.updateMs = std::min(row.updateMs, std::chrono::duration<double, std::milli>(t1 - t0).count());
+            row.submitMs = std::min(row.submitMs, std::chrono::duration<double, std::milli>(t2 - t1).count());
+            row.allocs += after.allocs - before.allocs;
+            checksum += batch.size();
+        }
+
+        Bench::doNotOptimize(checksum);
+        return row;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Bench::parseArgs(argc, argv);
+    bool quick = Bench::hasFlag(argc, argv, "--quick");
+
+    int count = quick ? 200000 : 1000000;
+    for (int i = 1; i + 1 < argc; ++i)
+        if (std::strcmp(argv[i], "--count") == 0)
+            count = std::max(1, std::atoi(argv[i + 1]));
+
+    const int frames = quick ? 20 : 60;
+    const int threadCounts[] = { 1, 2, 4, 8 };
+
+    printHeader(count);
+    double baselineMs = 0.0;
+    for (int threads : threadCounts)
+    {
+        Row row = run(threads, count, frames);
+        if (threads == 1)
+            baselineMs = row.updateMs + row.submitMs;
+        printRow(count, row, baselineMs);
+    }
+    return 0;
+}
@@ -0,0 +1,443 @@
+// ================= SCENARIO BENCHMARK =================
+// Drives full Survival and Dash sessions from scripted input at a fixed
+// 60 Hz tick with no window. Each tick runs world.update() and submits the
+// scene to a DrawList; with --offscreen the list is also flushed into a
+// RenderTexture when a GL context can be created.
+//
+//   ScenarioBench [scenario...] [--ticks N] [--quick] [--offscreen] [--csv]
+//                 [--min-tps N] [--max-allocs-per-tick N]
+//                 [--baseline results.csv] [--tolerance PERCENT] [--verbose]
+//
+// Scenarios: particles-10k, dash-1h, collectibles-5k (default: all).
+// Exits with 1 when a run misses a threshold or falls more than --tolerance
+// percent (default 10) below the ticks/sec recorded in --baseline, which is
+// a previous --csv output.
+//
+// Build from DSA_EL/DSA_EL sources (ECS worlds, MemoryTracker.cpp) with
+// DSA_TRACK_MEMORY defined; links sfml-graphics.
+
+#include "BenchCommon.hpp"
+#include "SurvivalWorld.hpp"
+#include "DashWorld.hpp"
+#include "DrawList.hpp"
+#include "FrameArena.hpp"
+#include "HdrHistogram.hpp"
+#include "Profiler.hpp"
+#include "Colors.hpp"
+#include "Effects.hpp"
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    constexpr float TICK = 1.f / 60.f;
+    const sf::Vector2f VIEW_SIZE(800.f, 600.f);
+
+    // ---------------- Options ----------------
+    struct Options
+    {
+        long long ticks = 0;              // 0 = scenario default
+        bool quick = false;
+        bool offscreen = false;
+        bool verbose = false;
+        double minTicksPerSec = 0.0;
+        double maxAllocsPerTick = -1.0;
+        std::string baseline;
+        double tolerance = 10.0;
+    };
+
+    // ---------------- Results ----------------
+    enum Phase
+    {
+        PhaseInput,
+        PhaseUpdate,
+        PhaseCollision,     // part of update
+        PhaseParticles,     // part of update
+        PhaseSubmit,
+        PhaseRender,
+        PhaseCount
+    };
+
+    const char* phaseName(int phase)
+    {
+        static const char* names[PhaseCount] = { "input", "update", "collision", "particles", "submit", "render" };
+        return names[phase];
+    }
+
+    struct Result
+    {
+        const char* scenario = "";
+        long long ticks = 0;
+        double seconds = 0.0;
+        double phaseMs[PhaseCount] = {};
+        HdrHistogram tickNs;               // per-tick wall time in nanoseconds
+        long long allocs = 0;
+        long long bytes = 0;
+        int sessions = 1;                  // resets after game over / crash + 1
+        long long peakParticles = 0;
+        long long peakEntities = 0;
+
+        double ticksPerSec() const { return seconds > 0.0 ? ticks / seconds : 0.0; }
+        double allocsPerTick() const { return ticks > 0 ? static_cast<double>(allocs) / ticks : 0.0; }
+    };
+
+    // ---------------- Session driver ----------------
+    // Script(world, tick) returns the tick's input; Prepare(world) runs after
+    // every reset; Over(world) says when to start a new session.
+    template<typename World, typename Script, typename Prepare, typename Over>
+    void runSession(World& world, Result& result, long long ticks, const Options& options,
+        Script script, Prepare prepare, Over over)
+    {
+        DrawList drawList;
+        std::unique_ptr<sf::RenderTexture> target;
+        if (options.offscreen)
+        {
+            target = std::make_unique<sf::RenderTexture>();
+            if (!target->resize({ static_cast<unsigned>(VIEW_SIZE.x), static_cast<unsigned>(VIEW_SIZE.y) }))
+            {
+                std::cerr << "[BENCH] No offscreen target available, rendering skipped\n";
+                target.reset();
+            }
+        }
+
+        Profiler& profiler = Profiler::getInstance();
+        profiler.setEnabled(true);
+        prepare(world);
+
+        Bench::AllocSnapshot allocsBefore = Bench::AllocSnapshot::take();
+        Bench::Clock::time_point runStart = Bench::Clock::now();
+
+        for (long long tick = 0; tick < ticks; ++tick)
+        {
+            Bench::Clock::time_point t0 = Bench::Clock::now();
+            PlayerInput input = script(world, tick);
+
+            Bench::Clock::time_point t1 = Bench::Clock::now();
+            {
+                ProfileScope profile(ProfileSection::Update);
+                world.update(TICK, input);
+            }
+
+            Bench::Clock::time_point t2 = Bench::Clock::now();
+            drawList.clear();
+            world.submit(drawList);
+
+            Bench::Clock::time_point t3 = Bench::Clock::now();
+            if (target)
+            {
+                target->clear();
+                target->setView(world.getCamera().getView());
+                drawList.flush(*target);
+                target->display();
+            }
+            Bench::Clock::time_point t4 = Bench::Clock::now();
+
+            profiler.endFrame();
+            FrameArena::getInstance().endFrame();
+            MemoryTracker::endFrame();
+
+            result.phaseMs[PhaseInput] += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            result.phaseMs[PhaseUpdate] += std::chrono::duration<double, std::milli>(t2 - t1).count();
+            result.phaseMs[PhaseSubmit] += std::chrono::duration<double, std::milli>(t3 - t2).count();
+            result.phaseMs[PhaseRender] += std::chrono::duration<double, std::milli>(t4 - t3).count();
+            result.phaseMs[PhaseCollision] += profiler.getSectionMs(ProfileSection::Collision);
+            result.phaseMs[PhaseParticles] += profiler.getSectionMs(ProfileSection::Particles);
+            result.tickNs.record(static_cast<std::uint64_t>(std::chrono::duration<double, std::nano>(t4 - t0).count()));
+
+            result.peakParticles = std::max<long long>(result.peakParticles, world.getParticles().size());
+            result.peakEntities = std::max<long long>(result.peakEntities, world.getRegistry().aliveCount());
+
+            if (over(world))
+            {
+                world.reset();
+                prepare(world);
+                result.sessions++;
+            }
+        }
+
+        result.seconds = std::chrono::duration<double>(Bench::Clock::now() - runStart).count();
+        Bench::AllocSnapshot allocsAfter = Bench::AllocSnapshot::take();
+        result.allocs = allocsAfter.allocs - allocsBefore.allocs;
+        result.bytes = allocsAfter.bytes - allocsBefore.bytes;
+        result.ticks = ticks;
+        profiler.setEnabled(false);
+    }
+
+    // Wandering figure-eight so the player crosses the whole arena
+    PlayerInput wander(long long tick, float scale)
+    {
+        float t = tick * TICK;
+        PlayerInput input;
+        input.move = { std::cos(t * 0.7f) * scale, std::sin(t * 1.4f) * scale };
+        return input;
+    }
+
+    // ---------------- Scenarios ----------------
+    // Survival with the particle system held at 10,000 live particles
+    Result particles10k(long long ticks, const Options& options)
+    {
+        Result result;
+        result.scenario = "particles-10k";
+        SurvivalWorld world(VIEW_SIZE, 10000 + SurvivalWorld::PARTICLE_BUDGET);
+        int fill = world.getParticles().addEmitter(Effects::pop(Colors::Warning, 0));
+
+        runSession(world, result, ticks, options,
+            [fill](SurvivalWorld& w, long long tick) {
+                ParticleSystem& particles = w.getParticles();
+                int missing = 10000 - particles.size();
+                if (missing > 0)
+                    particles.burst(fill, { 400.f, 300.f }, missing);
+                return wander(tick, 1.f);
+            },
+            [](SurvivalWorld&) {},
+            [](SurvivalWorld& w) { return w.isGameOver() || w.isWon(); });
+        return result;
+    }
+
+    // One continuous simulated hour of Dash. The player is invincible so the
+    // run reaches top speed and exercises long-run stream compaction; the
+    // autopilot still jumps at obstacles (later for spikes, earlier for the
+    // taller blocks) so jump and particle paths stay in the profile.
+    Result dashHour(long long ticks, const Options& options)
+    {
+        Result result;
+        result.scenario = "dash-1h";
+        DashWorld world(VIEW_SIZE);
+        world.setInvincible(true);
+
+        runSession(world, result, ticks, options,
+            [](DashWorld& w, long long) {
+                Registry& registry = w.getRegistry();
+                Entity player = NullEntity;
+                registry.view<PlayerTag>().each([&](Entity e, PlayerTag&) { player = e; });
+
+                PlayerInput input;
+                float px = registry.get<Transform>(player).position.x;
+                float speed = w.getScrollSpeed();
+                registry.view<SpikeTag, Transform>().each([&](Entity, SpikeTag&, Transform& t) {
+                    float dx = t.position.x - px;
+                    if (dx > 0.f && dx < 25.f + speed * 0.05f)
+                        input.jump = true;
+                });
+                registry.view<BlockTag, Transform>().each([&](Entity, BlockTag&, Transform& t) {
+                    float dx = t.position.x - px;
+                    if (dx > 0.f && dx < 20.f + speed * 0.13f)
+                        input.jump = true;
+                });
+                return input;
+            },
+            [](DashWorld&) {},
+            [](DashWorld& w) { return w.isCrashed(); });
+        return result;
+    }
+
+    // Survival with 5,000 stars around the edge of the arena; the player
+    // circles the centre so collision runs against the full set every tick
+    Result collectibles5k(long long ticks, const Options& options)
+    {
+        Result result;
+        result.scenario = "collectibles-5k";
+        SurvivalWorld world(VIEW_SIZE);
+
+        runSession(world, result, ticks, options,
+            [](SurvivalWorld&, long long tick) { return wander(tick, 0.25f); },
+            [](SurvivalWorld& w) {
+                sf::FloatRect arena = w.getArena();
+                std::srand(42);
+                for (int placed = 0; placed < 5000;)
+                {
+                    sf::Vector2f p(arena.position.x + 20.f + std::rand() % static_cast<int>(arena.size.x - 40.f),
+                        arena.position.y + 20.f + std::rand() % static_cast<int>(arena.size.y - 40.f));
+                    sf::Vector2f fromCentre = p - (arena.position + arena.size / 2.f);
+                    if (std::abs(fromCentre.x) < 150.f && std::abs(fromCentre.y) < 150.f)
+                        continue;   // keep the player's loop clear
+                    w.spawnCollectibleAt(p);
+                    placed++;
+                }
+            },
+            [](SurvivalWorld& w) { return w.isGameOver() || w.isWon(); });
+        return result;
+    }
+
+    struct Preset
+    {
+        const char* name;
+        long long defaultTicks;
+        Result (*run)(long long, const Options&);
+    };
+
+    const Preset PRESETS[] = {
+        { "particles-10k", 60 * 60, particles10k },          // 1 minute
+        { "dash-1h", 60 * 60 * 60, dashHour },               // 1 hour
+        { "collectibles-5k", 60 * 60, collectibles5k },      // 1 minute
+    };
+
+    // ---------------- Reporting ----------------
+    struct NullBuffer : std::streambuf
+    {
+        int overflow(int c) override { return c; }
+    };
+
+    void printHeader()
+    {
+        if (!Bench::csvMode())
+            return;
+        std::printf("scenario,ticks,ticks_per_sec,mean_tick_us,p99_tick_us,max_tick_us,allocs_per_tick,bytes_per_tick,sessions");
+        for (int p = 0; p < PhaseCount; ++p)
+            std::printf(",%s_us", phaseName(p));
+        std::printf("\n");
+    }
+
+    void printResult(const Result& r)
+    {
+        double ticks = static_cast<double>(r.ticks);
+        if (Bench::csvMode())
+        {
+            std::printf("%s,%lld,%.1f,%.2f,%.2f,%.2f,%.3f,%.1f,%d", r.scenario, r.ticks, r.ticksPerSec(),
+                r.tickNs.mean() / 1000.0, r.tickNs.percentile(99.0) / 1000.0, r.tickNs.max() / 1000.0,
+                r.allocsPerTick(), r.bytes / ticks, r.sessions);
+            for (int p = 0; p < PhaseCount; ++p)
+                std::printf(",%.2f", r.phaseMs[p] * 1000.0 / ticks);
+            std::printf("\n");
+            return;
+        }
+
+        std::printf("\n%s: %lld ticks in %.2f s (%.0f ticks/sec, %d session(s))\n",
+            r.scenario, r.ticks, r.seconds, r.ticksPerSec(), r.sessions);
+        std::printf("  tick      mean %8.2f us   p99 %8.2f us   max %8.2f us\n",
+            r.tickNs.mean() / 1000.0, r.tickNs.percentile(99.0) / 1000.0, r.tickNs.max() / 1000.0);
+        for (int p = 0; p < PhaseCount; ++p)
+        {
+            bool nested = p == PhaseCollision || p == PhaseParticles;
+            std::printf("  %s%-10s %8.2f us/tick\n", nested ? "  " : "", phaseName(p), r.phaseMs[p] * 1000.0 / ticks);
+        }
+        std::printf("  allocs    %8.3f /tick   %8.1f bytes/tick\n", r.allocsPerTick(), r.bytes / ticks);
+        std::printf("  peak      %8lld particles %6lld entities\n", r.peakParticles, r.peakEntities);
+    }
+
+    // ticks/sec for `scenario` from a previous --csv run, or 0 if absent
+    double baselineTicksPerSec(const std::string& path, const char* scenario)
+    {
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::stringstream fields(line);
+            std::string name, ticks, tps;
+            if (std::getline(fields, name, ',') && name == scenario &&
+                std::getline(fields, ticks, ',') && std::getline(fields, tps, ','))
+                return std::atof(tps.c_str());
+        }
+        return 0.0;
+    }
+
+    // Prints every threshold the result misses; returns true when it passes
+    bool checkThresholds(const Result& r, const Options& options)
+    {
+        bool pass = true;
+        if (options.minTicksPerSec > 0.0 && r.ticksPerSec() < options.minTicksPerSec)
+        {
+            std::fprintf(stderr, "[BENCH] FAIL %s: %.0f ticks/sec < minimum %.0f\n",
+                r.scenario, r.ticksPerSec(), options.minTicksPerSec);
+            pass = false;
+        }
+        if (options.maxAllocsPerTick >= 0.0 && r.allocsPerTick() > options.maxAllocsPerTick)
+        {
+            std::fprintf(stderr, "[BENCH] FAIL %s: %.3f allocs/tick > maximum %.3f\n",
+                r.scenario, r.allocsPerTick(), options.maxAllocsPerTick);
+            pass = false;
+        }
+        if (!options.baseline.empty())
+        {
+            double base = baselineTicksPerSec(options.baseline, r.scenario);
+            double floor = base * (1.0 - options.tolerance / 100.0);
+            if (base <= 0.0)
+                std::fprintf(stderr, "[BENCH] %s not in baseline %s\n", r.scenario, options.baseline.c_str());
+            else if (r.ticksPerSec() < floor)
+            {
+                std::fprintf(stderr, "[BENCH] FAIL %s: %.0f ticks/sec is %.1f%% below baseline %.0f\n",
+                    r.scenario, r.ticksPerSec(), 100.0 * (1.0 - r.ticksPerSec() / base), base);
+                pass = false;
+            }
+        }
+        return pass;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Bench::parseArgs(argc, argv);
+
+    Options options;
+    DynamicArray<const Preset*> selected;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--ticks" && hasValue)
+            options.ticks = std::atoll(argv[++i]);
+        else if (arg == "--min-tps" && hasValue)
+            options.minTicksPerSec = std::atof(argv[++i]);
+        else if (arg == "--max-allocs-per-tick" && hasValue)
+            options.maxAllocsPerTick = std::atof(argv[++i]);
+        else if (arg == "--baseline" && hasValue)
+            options.baseline = argv[++i];
+        else if (arg == "--tolerance" && hasValue)
+            options.tolerance = std::atof(argv[++i]);
+        else if (arg == "--quick")
+            options.quick = true;
+        else if (arg == "--offscreen")
+            options.offscreen = true;
+        else if (arg == "--verbose")
+            options.verbose = true;
+        else if (arg == "--csv")
+            continue;
+        else
+        {
+            const Preset* match = nullptr;
+            for (const Preset& preset : PRESETS)
+                if (arg == preset.name)
+                    match = &preset;
+            if (!match)
+            {
+                std::fprintf(stderr, "[BENCH] Unknown argument: %s\n", arg.c_str());
+                return 2;
+            }
+            selected.push_back(match);
+        }
+    }
+    if (selected.size() == 0)
+        for (const Preset& preset : PRESETS)
+            selected.push_back(&preset);
+
+    // Gameplay logs every pickup and crash; keep them out of the report
+    NullBuffer discarded;
+    std::streambuf* coutBuffer = std::cout.rdbuf();
+    if (!options.verbose)
+        std::cout.rdbuf(&discarded);
+
+    printHeader();
+    bool pass = true;
+    for (int i = 0; i < selected.size(); ++i)
+    {
+        const Preset& preset = *selected[i];
+        long long ticks = options.ticks > 0 ? options.ticks : preset.defaultTicks;
+        if (options.quick && options.ticks == 0)
+            ticks /= 10;
+
+        std::srand(1234);
+        Result result = preset.run(ticks, options);
+
+        printResult(result);
+        pass = checkThresholds(result, options) && pass;
+    }
+
+    std::cout.rdbuf(coutBuffer);
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+
+// World-space camera backed by an sf::View.
+// Entities keep fixed world coordinates; scrolling only moves the camera.
+class Camera
+{
+public:
+    Camera(sf::Vector2f viewSize = { 0.f, 0.f })
+        : m_size(viewSize), m_position(0.f, 0.f), m_bounded(false)
+    {
+    }
+
+    // Restrict the camera to a world rectangle (e.g. a Survival arena larger than the screen)
+    void setBounds(const sf::FloatRect& bounds)
+    {
+        m_bounds = bounds;
+        m_bounded = true;
+        setPosition(m_position);
+    }
+
+    void clearBounds()
+    {
+        m_bounded = false;
+    }
+
+    // Top-left corner of the visible area in world coordinates
+    void setPosition(sf::Vector2f topLeft)
+    {
+        m_position = topLeft;
+        if (m_bounded)
+        {
+            float maxX = m_bounds.position.x + std::max(0.f, m_bounds.size.x - m_size.x);
+            float maxY = m_bounds.position.y + std::max(0.f, m_bounds.size.y - m_size.y);
+            m_position.x = std::clamp(m_position.x, m_bounds.position.x, maxX);
+            m_position.y = std::clamp(m_position.y, m_bounds.position.y, maxY);
+        }
+    }
+
+    void move(sf::Vector2f offset)
+    {
+        setPosition(m_position + offset);
+    }
+
+    // Keep a world point at the given screen anchor (clamped to bounds)
+    void follow(sf::Vector2f target, sf::Vector2f screenAnchor)
+    {
+        setPosition(target - screenAnchor);
+    }
+
+    sf::Vector2f getPosition() const { return m_position; }
+    sf::Vector2f getSize() const { return m_size; }
+
+    float getLeft() const { return m_position.x; }
+    float getRight() const { return m_position.x + m_size.x; }
+    float getTop() const { return m_position.y; }
+    float getBottom() const { return m_position.y + m_size.y; }
+
+    sf::FloatRect getVisibleArea() const
+    {
+        return sf::FloatRect(m_position, m_size);
+    }
+
+    sf::View getView() const
+    {
+        return sf::View(sf::FloatRect(m_position, m_size));
+    }
+
+    // Draw subsequent world geometry through this camera. Keeps the target's
+    // current viewport, so a letterboxed screen view stays letterboxed.
+    void apply(sf::RenderTarget& target) const
+    {
+        sf::View view = getView();
+        view.setViewport(target.getView().getViewport());
+        target.setView(view);
+    }
+
+    sf::Vector2f worldToScreen(sf::Vector2f world) const { return world - m_position; }
+    sf::Vector2f screenToWorld(sf::Vector2f screen) const { return screen + m_position; }
+
+private:
+    sf::Vector2f m_size;
+    sf::Vector2f m_position;
+    sf::FloatRect m_bounds;
+    bool m_bounded;
+};
@@ -0,0 +1,212 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "Components.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Collision
+{
+    // Collider resolved into world space
+    struct WorldCollider
+    {
+        ColliderShape shape = ColliderShape::Box;
+        sf::FloatRect box;                // Box bounds (Circle: its bounding box)
+        sf::Vector2f center;
+        float radius = 0.f;
+    };
+
+    inline WorldCollider toWorld(const Transform& t, const Collider& c)
+    {
+        WorldCollider w;
+        w.shape = c.shape;
+        if (c.shape == ColliderShape::Box)
+        {
+            w.box = sf::FloatRect(t.position + c.offset, c.size);
+            w.center = w.box.position + c.size / 2.f;
+        }
+        else
+        {
+            w.center = t.position + c.offset;
+            w.radius = c.radius;
+            w.box = sf::FloatRect(w.center - sf::Vector2f(c.radius, c.radius), { c.radius * 2.f, c.radius * 2.f });
+        }
+        return w;
+    }
+
+    inline bool aabbOverlap(const sf::FloatRect& a, const sf::FloatRect& b)
+    {
+        return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+               a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+    }
+
+    // Squared distances only, no sqrt
+    inline bool circleOverlap(sf::Vector2f ca, float ra, sf::Vector2f cb, float rb)
+    {
+        sf::Vector2f d = ca - cb;
+        float r = ra + rb;
+        return d.x * d.x + d.y * d.y < r * r;
+    }
+
+    inline bool boxCircleOverlap(const sf::FloatRect& box, sf::Vector2f c, float r)
+    {
+        float nx = std::clamp(c.x, box.position.x, box.position.x + box.size.x);
+        float ny = std::clamp(c.y, box.position.y, box.position.y + box.size.y);
+        float dx = c.x - nx;
+        float dy = c.y - ny;
+        return dx * dx + dy * dy < r * r;
+    }
+
+    // ---------------- Swept AABB ----------------
+    struct SweepHit
+    {
+        float time = 0.f;                 // Fraction of the move at first contact, 0..1
+        float exitTime = 0.f;             // Fraction at which they separate again (may exceed 1)
+        sf::Vector2f normal;              // Target face that was hit; zero when overlapping at the start
+    };
+
+    // Earliest moment `moving`, translated by time * delta, touches `target`
+    // (slab test on the target grown by the moving box). Frame-rate
+    // independent: a fast mover can't step over a thin target between
+    // frames. Returns false when they don't meet during this move.
+    inline bool sweepAabb(const sf::FloatRect& moving, sf::Vector2f delta, const sf::FloatRect& target, SweepHit& hit)
+    {
+        float entry[2];
+        float exit[2];
+        const float start[2] = { moving.position.x, moving.position.y };
+        const float size[2] = { moving.size.x, moving.size.y };
+        const float targetStart[2] = { target.position.x, target.position.y };
+        const float targetSize[2] = { target.size.x, target.size.y };
+        const float d[2] = { delta.x, delta.y };
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            // Gap to close before touching and to cross before separating
+            float low = targetStart[axis] - (start[axis] + size[axis]);
+            float high = targetStart[axis] + targetSize[axis] - start[axis];
+            if (d[axis] == 0.f)
+            {
+                if (low >= 0.f || high <= 0.f)
+                    return false;                   // Apart on an axis it never moves along
+                entry[axis] = -1e30f;
+                exit[axis] = 1e30f;
+            }
+            else if (d[axis] > 0.f)
+            {
+                entry[axis] = low / d[axis];
+                exit[axis] = high / d[axis];
+            }
+            else
+            {
+                entry[axis] = high / d[axis];
+                exit[axis] = low / d[axis];
+            }
+        }
+
+        float enter = std::max(entry[0], entry[1]);
+        float leave = std::min(exit[0], exit[1]);
+        if (enter >= leave || leave <= 0.f || enter > 1.f)
+            return false;
+
+        hit.exitTime = leave;
+        if (enter < 0.f)
+        {
+            // Already overlapping when the move starts
+            hit.time = 0.f;
+            hit.normal = { 0.f, 0.f };
+        }
+        else
+        {
+            hit.time = enter;
+            if (entry[0] > entry[1])
+                hit.normal = { d[0] > 0.f ? -1.f : 1.f, 0.f };
+            else
+                hit.normal = { 0.f, d[1] > 0.f ? -1.f : 1.f };
+        }
+        return true;
+    }
+
+    // ---------------- Convex polygons (SAT) ----------------
+    // Hull resolved into world space, with its bounding box for the cheap reject
+    struct WorldHull
+    {
+        sf::Vector2f points[Hull::MAX_POINTS];
+        int count = 0;
+        sf::FloatRect bounds;
+    };
+
+    inline WorldHull toWorld(const Transform& t, const Hull& h)
+    {
+        float radians = t.rotation * 3.14159265f / 180.f;
+        float c = std::cos(radians);
+        float s = std::sin(radians);
+
+        WorldHull w;
+        w.count = h.count;
+        sf::Vector2f low(1e30f, 1e30f);
+        sf::Vector2f high(-1e30f, -1e30f);
+        for (int i = 0; i < h.count; ++i)
+        {
+            sf::Vector2f p(h.points[i].x * t.scale.x, h.points[i].y * t.scale.y);
+            p = sf::Vector2f(p.x * c - p.y * s, p.x * s + p.y * c) + t.position;
+            w.points[i] = p;
+            low = { std::min(low.x, p.x), std::min(low.y, p.y) };
+            high = { std::max(high.x, p.x), std::max(high.y, p.y) };
+        }
+        w.bounds = sf::FloatRect(low, high - low);
+        return w;
+    }
+
+    // True when some edge normal of `a` separates the two projections
+    inline bool hasSeparatingAxis(const WorldHull& a, const WorldHull& b)
+    {
+        for (int i = 0; i < a.count; ++i)
+        {
+            sf::Vector2f edge = a.points[(i + 1) % a.count] - a.points[i];
+            sf::Vector2f axis(-edge.y, edge.x);      // Unnormalised: only the ordering matters
+
+            float minA = 1e30f, maxA = -1e30f;
+            for (int k = 0; k < a.count; ++k)
+            {
+                float p = axis.x * a.points[k].x + axis.y * a.points[k].y;
+                minA = std::min(minA, p);
+                maxA = std::max(maxA, p);
+            }
+            float minB = 1e30f, maxB = -1e30f;
+            for (int k = 0; k < b.count; ++k)
+            {
+                float p = axis.x * b.points[k].x + axis.y * b.points[k].y;
+                minB = std::min(minB, p);
+                maxB = std::max(maxB, p);
+            }
+
+            if (maxA <= minB || maxB <= minA)
+                return true;
+        }
+        return false;
+    }
+
+    // Separating axis test: two convex polygons overlap unless an edge normal
+    // of either one separates them. Touching edges don't count as overlap.
+    inline bool hullOverlap(const WorldHull& a, const WorldHull& b)
+    {
+        // Cheap bounding-box reject first
+        if (!aabbOverlap(a.bounds, b.bounds))
+            return false;
+        return !hasSeparatingAxis(a, b) && !hasSeparatingAxis(b, a);
+    }
+
+    inline bool overlaps(const WorldCollider& a, const WorldCollider& b)
+    {
+        // Cheap bounding-box reject first
+        if (!aabbOverlap(a.box, b.box))
+            return false;
+
+        if (a.shape == ColliderShape::Box && b.shape == ColliderShape::Box)
+            return true;
+        if (a.shape == ColliderShape::Circle && b.shape == ColliderShape::Circle)
+            return circleOverlap(a.center, a.radius, b.center, b.radius);
+        if (a.shape == ColliderShape::Box)
+            return boxCircleOverlap(a.box, b.center, b.radius);
+        return boxCircleOverlap(b.box, a.center, a.radius);
+    }
+}
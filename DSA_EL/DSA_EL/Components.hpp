@@ -0,0 +1,120 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "DrawList.hpp"
+
+// ================= CORE COMPONENTS =================
+// Plain data only; behaviour lives in Systems.hpp
+
+struct Transform
+{
+    sf::Vector2f position;
+    float rotation = 0.f;                 // Degrees
+    sf::Vector2f scale{ 1.f, 1.f };
+};
+
+struct Velocity
+{
+    sf::Vector2f value;
+};
+
+struct Gravity
+{
+    float strength = 0.f;                 // px/s^2, applied to Velocity.y
+};
+
+enum class ColliderShape : std::uint8_t
+{
+    Box,
+    Circle
+};
+
+// Box: rectangle at position + offset. Circle: centred at position + offset.
+struct Collider
+{
+    ColliderShape shape = ColliderShape::Box;
+    sf::Vector2f offset;
+    sf::Vector2f size;
+    float radius = 0.f;
+
+    static Collider box(sf::Vector2f offset, sf::Vector2f size)
+    {
+        Collider c;
+        c.shape = ColliderShape::Box;
+        c.offset = offset;
+        c.size = size;
+        return c;
+    }
+
+    static Collider circle(sf::Vector2f centerOffset, float radius)
+    {
+        Collider c;
+        c.shape = ColliderShape::Circle;
+        c.offset = centerOffset;
+        c.radius = radius;
+        return c;
+    }
+};
+
+// Exact convex outline in local space (points in order, either winding),
+// turned and moved with the Transform. Narrow phase on top of a Collider,
+// which stays the entity's cheap broad-phase box.
+struct Hull
+{
+    static constexpr int MAX_POINTS = 8;
+    sf::Vector2f points[MAX_POINTS];
+    int count = 0;
+
+    static Hull polygon(const sf::Vector2f* pts, int n)
+    {
+        Hull h;
+        h.count = n < MAX_POINTS ? n : MAX_POINTS;
+        for (int i = 0; i < h.count; ++i)
+            h.points[i] = pts[i];
+        return h;
+    }
+
+    static Hull box(sf::Vector2f offset, sf::Vector2f size)
+    {
+        const sf::Vector2f corners[4] = {
+            offset, { offset.x + size.x, offset.y }, offset + size, { offset.x, offset.y + size.y } };
+        return polygon(corners, 4);
+    }
+};
+
+// Keeps an entity of `extent` size inside `area`: clamps, or reflects velocity when bouncing
+struct Bounded
+{
+    sf::FloatRect area;
+    sf::Vector2f extent;
+    bool bounce = false;
+};
+
+struct Lifetime
+{
+    float remaining = 0.f;
+};
+
+// Soft halo drawn behind the shape
+struct Glow
+{
+    bool enabled = false;
+    sf::Color color;
+    float padding = 0.f;                  // Rectangle / Circle growth in px
+    float scale = 1.f;                    // Polygon scale factor
+};
+
+struct Renderable
+{
+    ShapeDesc shape;
+    Glow glow;
+    RenderLayer layer = RenderLayer::Middle;
+    bool visible = true;
+};
+
+// ================= TAGS =================
+struct PlayerTag {};
+struct EnemyTag {};
+struct CollectibleTag {};
+struct SpikeTag {};
+struct BlockTag {};
+struct OrbTag {};
@@ -1,163 +1,179 @@
-#include "Game.hpp"
+#include "MenuScene.hpp"
+#include "Window.hpp"
+#include "RenderScaler.hpp"
+#include "WorkerThread.hpp"
+#include "ResourceManager.hpp"
+#include "PerfOverlay.hpp"
+#include "FrameMetrics.hpp"
+#include "FrameArena.hpp"
+#include "MemoryTracker.hpp"
 #include <iostream>
-
-// Main menu GUI for game selection
-void runMainMenu()
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+
+// One window (and GL context) for the whole session; modes are scenes on the stack.
+// Pipelined: the simulation thread steps frame N+1 while this thread draws frame N.
+void runApplication(const WindowSettings& settings, bool pipelined)
 {
-    sf::RenderWindow window(sf::VideoMode({ 800, 600 }), "DSA Game Engine");
-    window.setFramerateLimit(60);
-
-    // Load font
-    sf::Font* mainFont = ResourceManager::getInstance().getFont("C:/Windows/Fonts/arial.ttf");
-
-    // UI Buttons
-    float centerX = 400.f;
-
-    std::unique_ptr<Button> survivalButton = std::make_unique<Button>(
-        sf::Vector2f(280.f, 65.f),
-        sf::Vector2f(centerX - 140.f, 220.f),
-        "SURVIVAL",
-        mainFont
-    );
-
-    std::unique_ptr<Button> platformerButton = std::make_unique<Button>(
-        sf::Vector2f(280.f, 65.f),
-        sf::Vector2f(centerX - 140.f, 310.f),
-        "DASH",
-        mainFont
-    );
-
-    std::unique_ptr<Button> exitButton = std::make_unique<Button>(
-        sf::Vector2f(180.f, 50.f),
-        sf::Vector2f(centerX - 90.f, 420.f),
-        "EXIT",
-        mainFont
-    );
-
-    int selectedGame = 0; // 0 = none, 1 = survival, 2 = platformer
-    bool wasMousePressed = true;  // Start true to prevent immediate click
-
-    while (window.isOpen())
-    {
-        // Events
-        while (auto e = window.pollEvent())
-        {
-            if (e->is<sf::Event::Closed>())
-                window.close();
-        }
+    Window window(settings);
+    RenderScaler scaler(window);       // Scenes render offscreen at virtual size * scale
 
-        // Update buttons
-        survivalButton->update(window);
-        platformerButton->update(window);
-        exitButton->update(window);
+    // Load font (after the window, so it shares the one context)
+    sf::Font* mainFont = ResourceManager::getInstance().getDefaultFont();
 
-        bool mousePressed = sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
-        
-        // Only trigger on mouse release (click complete)
-        if (!mousePressed && wasMousePressed)
-        {
-            sf::Vector2f mouse = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+    SceneStack scenes(window, mainFont);
+    scenes.push(std::make_unique<MenuScene>(scenes));
+    scenes.applyPending();
 
-            if (survivalButton->getShape().getGlobalBounds().contains(mouse))
-            {
-                selectedGame = 1;
-                window.close();
-            }
-            else if (platformerButton->getShape().getGlobalBounds().contains(mouse))
-            {
-                selectedGame = 2;
-                window.close();
-            }
-            else if (exitButton->getShape().getGlobalBounds().contains(mouse))
-            {
-                selectedGame = 0;
-                window.close();
-            }
-        }
-        wasMousePressed = mousePressed;
+    PerfOverlay perfOverlay(mainFont, window.getVirtualSize().x);   // F3
 
-        // Render
-        window.clear(Colors::Background);
+    std::unique_ptr<WorkerThread> simThread;
+    if (pipelined)
+        simThread = std::make_unique<WorkerThread>();
+    std::cout << "[GAME] Update/render: " << (pipelined ? "pipelined (simulation thread)" : "single thread") << "\n";
 
-        // Background grid
-        sf::RectangleShape line;
-        line.setFillColor(sf::Color(40, 40, 60, 100));
-        for (float x = 0; x < 800.f; x += 50.f)
+    // Closed and F3 are handled here; everything else goes to the top scene
+    auto dispatch = [&](const sf::Event& event) {
+        if (event.is<sf::Event::Closed>())
         {
-            line.setSize({ 1.f, 600.f });
-            line.setPosition({ x, 0.f });
-            window.draw(line);
+            window.close();
+            return;
         }
-        for (float y = 0; y < 600.f; y += 50.f)
+
+        if (auto* keyEvent = event.getIf<sf::Event::KeyPressed>())
         {
-            line.setSize({ 800.f, 1.f });
-            line.setPosition({ 0.f, y });
-            window.draw(line);
+            if (keyEvent->code == sf::Keyboard::Key::F3)
+            {
+                perfOverlay.toggle();
+                return;
+            }
         }
 
-        // Title
-        if (mainFont)
+        scenes.handleEvent(event);
+    };
+
+    sf::Clock clock;
+    bool redraw = true;     // The stack changed since the last presented frame
+
+    while (window.isOpen() && !scenes.empty())
+    {
+        // Static screens (menu, pause, results) sleep until the OS delivers input
+        if (!redraw && scenes.isIdle() && !perfOverlay.isVisible())
         {
-            sf::Text title(*mainFont, "GAME ENGINE", 52);
-            title.setFillColor(Colors::Accent);
-            sf::FloatRect bounds = title.getLocalBounds();
-            title.setPosition({
-                (800.f - bounds.size.x) / 2.f,
-                60.f
-            });
-            window.draw(title);
-
-            sf::Text subtitle(*mainFont, "Select a game", 20);
-            subtitle.setFillColor(Colors::TextDim);
-            bounds = subtitle.getLocalBounds();
-            subtitle.setPosition({
-                (800.f - bounds.size.x) / 2.f,
-                130.f
-            });
-            window.draw(subtitle);
+            if (std::optional<sf::Event> event = window.waitEvent())
+                dispatch(*event);
+            clock.restart();    // Time spent asleep is not frame time
         }
 
-        // Draw buttons
-        survivalButton->draw(window);
-        platformerButton->draw(window);
-        exitButton->draw(window);
+        float dt = clock.restart().asSeconds();
+        const char* frameMode = scenes.mode();
+        const char* frameState = scenes.state();
+
+        while (auto event = window.pollEvent())
+            dispatch(*event);
+
+        if (!window.isOpen())
+            break;
+
+        // Simulation idle: publish last frame's snapshots, sample input, react to it
+        scenes.sync();
 
-        // Footer
-        if (mainFont)
+        float updateMs = 0.f;
+        auto simulate = [&]() {
+            sf::Clock updateClock;
+            ProfileScope profile(ProfileSection::Update);
+            scenes.update(dt);
+            updateMs = updateClock.getElapsedTime().asMicroseconds() / 1000.f;
+        };
+
+        if (simThread)
+            simThread->run(simulate);
+        else
+            simulate();
+
+        sf::Clock renderClock;
         {
-            sf::Text footer(*mainFont, "DSA Project - SFML 3.0", 14);
-            footer.setFillColor(sf::Color(80, 80, 100));
-            sf::FloatRect bounds = footer.getLocalBounds();
-            footer.setPosition({
-                (800.f - bounds.size.x) / 2.f,
-                560.f
-            });
-            window.draw(footer);
+            ProfileScope profile(ProfileSection::Render);
+            scenes.render(scaler.begin(), scaler.view());
+            scaler.present();
         }
+        float renderMs = renderClock.getElapsedTime().asMicroseconds() / 1000.f;
+
+        if (simThread)
+            simThread->wait();
 
+        perfOverlay.draw(window.native(), window.view());
         window.display();
-    }
 
-    // Launch selected game
-    if (selectedGame == 1)
-    {
-        Game game;
-        game.run();
-    }
-    else if (selectedGame == 2)
-    {
-        runGame2();
+        // Work time only: display() may block on vsync or the frame cap. The
+        // two halves overlap when pipelined, so the longer one bounds the frame.
+        scaler.adapt(simThread ? std::max(updateMs, renderMs) : updateMs + renderMs);
+
+        FrameMetrics::getInstance().record(frameMode, frameState, dt * 1000.f, updateMs, renderMs);
+
+        Profiler::getInstance().endFrame();
+        perfOverlay.update();
+
+        // Scene switches land between frames, never mid-update
+        redraw = scenes.applyPending();
+
+        FrameArena::getInstance().endFrame();
+        MemoryTracker::endFrame();
     }
+
+    FrameMetrics::getInstance().flush();
 }
 
-int main()
+int main(int argc, char** argv)
 {
     std::srand(static_cast<unsigned>(std::time(nullptr)));
-    
+
+    // --metrics <file.csv|file.json>: dump frame-time percentiles for soak runs
+    // --memory-json <file.json>: write allocation stats at exit (DSA_TRACK_MEMORY builds)
+    // --vsync / --fps <n>: frame pacing (0 = uncapped)
+    // --size <w>x<h>: window size (scenes keep their 800x600 virtual resolution)
+    // --scale <s> / --dynamic-scale: offscreen render scale, fixed or adaptive up to s
+    // --single-thread: run update and render back to back on the main thread
+    WindowSettings settings;
+    bool pipelined = true;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--metrics" && i + 1 < argc)
+            FrameMetrics::getInstance().setOutput(argv[++i]);
+        else if (arg == "--memory-json" && i + 1 < argc)
+            MemoryTracker::setExitJson(argv[++i]);
+        else if (arg == "--vsync")
+            settings.vsync = true;
+        else if (arg == "--fps" && i + 1 < argc)
+            settings.framerateLimit = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else if (arg == "--size" && i + 1 < argc)
+        {
+            std::string size = argv[++i];
+            std::string::size_type x = size.find('x');
+            int width = x != std::string::npos ? std::atoi(size.substr(0, x).c_str()) : 0;
+            int height = x != std::string::npos ? std::atoi(size.substr(x + 1).c_str()) : 0;
+            if (width > 0 && height > 0)
+            {
+                settings.width = static_cast<unsigned int>(width);
+                settings.height = static_cast<unsigned int>(height);
+            }
+        }
+        else if (arg == "--scale" && i + 1 < argc)
+            settings.renderScale = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--dynamic-scale")
+            settings.dynamicScale = true;
+        else if (arg == "--single-thread")
+            pipelined = false;
+    }
+
     std::cout << "===== DSA GAME ENGINE =====\n";
     std::cout << "Select a game from the menu!\n\n";
 
-    runMainMenu();
+    runApplication(settings, pipelined);
 
     return 0;
 }
@@ -0,0 +1,259 @@
+#include "DashScene.hpp"
+#include "OverlayScenes.hpp"
+#include "Profiler.hpp"
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+
+namespace
+{
+    constexpr float WINDOW_WIDTH = 800.f;
+    constexpr float WINDOW_HEIGHT = 600.f;
+    constexpr float GROUND_Y = DashWorld::GROUND_Y;  // Ground level
+
+    // Best score survives trips back to the main menu
+    int g_highScore = 0;
+
+    bool jumpKeyDown()
+    {
+        return sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) ||
+               sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up) ||
+               sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W);
+    }
+}
+
+// ---------------- Constructor ----------------
+DashScene::DashScene(SceneStack& stack)
+    : Scene(stack), m_font(stack.font()), m_world({ WINDOW_WIDTH, WINDOW_HEIGHT }),
+      m_scoreLabel("0", m_font, 36), m_distanceLabel("0m", m_font, 18),
+      m_shownScore(0), m_shownMeters(0),
+      m_attempts(0), m_crashed(false), m_crashPending(false), m_jumpTapped(false),
+      m_wasMousePressed(false), m_wasSpacePressed(false)
+{
+    m_ground.setSize({ WINDOW_WIDTH, WINDOW_HEIGHT - GROUND_Y });
+    m_ground.setPosition({ 0.f, GROUND_Y });
+    m_ground.setFillColor(Colors::Platform);
+
+    m_groundLine.setSize({ WINDOW_WIDTH, 4.f });
+    m_groundLine.setPosition({ 0.f, GROUND_Y });
+    m_groundLine.setFillColor(Colors::Accent);
+
+    m_distanceLabel.setColor(Colors::TextDim);
+    m_scoreLabel.setAnchor(Anchor::Top);
+    m_scoreLabel.setMargin({ 0.f, 20.f, 0.f, 0.f });
+    m_distanceLabel.setAnchor(Anchor::TopRight);
+    m_distanceLabel.setMargin({ 0.f, 20.f, 20.f, 0.f });
+    m_ui.addChild(&m_scoreLabel);
+    m_ui.addChild(&m_distanceLabel);
+
+    // Particle snapshots sized for the whole pool up front
+    for (int i = 0; i < 2; ++i)
+        m_frames[i].particles.reserve(m_world.getParticles().capacity());
+}
+
+void DashScene::enter()
+{
+    m_stack.window().setTitle("DSA Dash");
+    resetGame();
+    resume();
+}
+
+// Back on top: the click or key that closed the previous scene is not a jump
+void DashScene::resume()
+{
+    m_wasMousePressed = sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
+    m_wasSpacePressed = jumpKeyDown();
+}
+
+void DashScene::resetGame()
+{
+    m_attempts++;
+    m_crashed = false;
+    m_crashPending = false;
+    m_world.reset();
+
+    // Fresh run on screen before its first update
+    writeFrame();
+    m_frames.swap();
+
+    std::cout << ">>> DASH GAME STARTED (Attempt " << m_attempts << ") <<<\n";
+    std::cout << "[ECS] Registry: " << m_world.getRegistry().aliveCount() << " entities\n";
+    std::cout << "[DSA] DynamicArray: Obstacle/orb streams sorted by world x\n";
+    std::cout << "[DSA] Stack: Scene stack (pause and crash screens are overlays)\n";
+}
+
+void DashScene::handleEvent(const sf::Event& event)
+{
+    if (auto* keyEvent = event.getIf<sf::Event::KeyPressed>())
+    {
+        if (keyEvent->code == sf::Keyboard::Key::Escape && !m_crashed)
+            m_stack.push(std::make_unique<PauseScene>(m_stack));
+    }
+}
+
+// Between frames: publish the last update, push the crash overlay once, sample input
+void DashScene::sync()
+{
+    m_frames.swap();
+
+    if (m_crashPending)
+    {
+        m_crashPending = false;
+        crash();
+    }
+
+    if (!m_crashed)
+        pollInput();
+}
+
+// Jump on tap (space/up/W press or mouse release); main thread, read by the next update()
+void DashScene::pollInput()
+{
+    bool mousePressed = sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
+    bool mouseClicked = !mousePressed && m_wasMousePressed;
+    m_wasMousePressed = mousePressed;
+
+    bool spacePressed = jumpKeyDown();
+    bool spaceTapped = spacePressed && !m_wasSpacePressed;
+    m_wasSpacePressed = spacePressed;
+
+    m_jumpTapped = spaceTapped || mouseClicked;
+}
+
+void DashScene::update(float dt)
+{
+    if (dt > 0.05f) dt = 0.05f;
+
+    // Crashed: only the explosion keeps playing under the crash overlay
+    if (m_crashed)
+    {
+        m_world.getParticles().update(dt);
+        writeFrame();
+        return;
+    }
+
+    PlayerInput input;
+    input.jump = m_jumpTapped;
+    m_world.update(dt, input);
+
+    if (m_world.isCrashed())
+    {
+        m_crashed = true;
+        m_crashPending = true;
+    }
+    writeFrame();
+}
+
+// Copies what render() draws out of the world; called by update(), or
+// from the main thread while the simulation is idle
+void DashScene::writeFrame()
+{
+    DashFrame& frame = m_frames.back();
+    frame.drawList.clear();
+    m_world.submit(frame.drawList);
+    m_world.getParticles().submit(frame.particles);
+    frame.camera = m_world.getCamera();
+    frame.score = m_world.getScore();
+    frame.distance = m_world.getDistance();
+    frame.showHud = !m_crashed;
+    frame.obstacles = m_world.getObstacleCount();
+}
+
+// Only a changed value rebuilds its string (and re-runs the HUD layout)
+void DashScene::updateHud(const DashFrame& frame)
+{
+    int score = frame.score;
+    if (score != m_shownScore)
+    {
+        m_shownScore = score;
+        m_scoreLabel.setText(std::to_string(score));
+    }
+
+    int meters = static_cast<int>(std::lround(frame.distance / 10.f));
+    if (meters != m_shownMeters)
+    {
+        m_shownMeters = meters;
+        m_distanceLabel.setText(std::to_string(meters) + "m");
+    }
+}
+
+// After a crash the scene only moves until the explosion has burnt out
+bool DashScene::isAnimating() const
+{
+    return !m_crashed || m_world.getParticles().size() > 0;
+}
+
+// Updates the best score and pushes the crash overlay (once per run, from sync())
+void DashScene::crash()
+{
+    bool newBest = m_world.getScore() >= g_highScore && m_world.getScore() > 0;
+    if (m_world.getScore() > g_highScore)
+    {
+        g_highScore = m_world.getScore();
+        std::cout << ">>> NEW HIGH SCORE: " << g_highScore << " <<<\n";
+    }
+
+    char buf[64];
+    DynamicArray<OverlayText> lines;
+    lines.push_back({ "CRASH!", 56, Colors::Danger });
+    if (newBest)
+        lines.push_back({ "NEW BEST!", 24, Colors::Success });
+    snprintf(buf, sizeof(buf), "Score: %d", m_world.getScore());
+    lines.push_back({ buf, 32, Colors::Warning });
+    snprintf(buf, sizeof(buf), "Distance: %.0fm", m_world.getDistance() / 10.f);
+    lines.push_back({ buf, 20, Colors::Text });
+    snprintf(buf, sizeof(buf), "Attempt #%d", m_attempts);
+    lines.push_back({ buf, 18, Colors::TextDim });
+
+    m_stack.push(std::make_unique<GameOverScene>(m_stack, std::move(lines), [this]() { resetGame(); }, false));
+}
+
+void DashScene::render(sf::RenderTarget& target)
+{
+    // Main thread: draws the last published frame while update() builds the next
+    DashFrame& frame = m_frames.front();
+
+    target.clear(sf::Color(20, 20, 35));
+
+    // Background (screen space, scrolls with the camera)
+    target.setView(m_stack.screenView());
+
+    sf::RectangleShape gridLine;
+    gridLine.setFillColor(sf::Color(35, 35, 55));
+
+    for (float x = -std::fmod(frame.camera.getLeft(), 80.f); x < WINDOW_WIDTH; x += 80.f)
+    {
+        gridLine.setSize({ 2.f, GROUND_Y });
+        gridLine.setPosition({ x, 0.f });
+        target.draw(gridLine);
+    }
+
+    for (float y = 80.f; y < GROUND_Y; y += 80.f)
+    {
+        gridLine.setSize({ WINDOW_WIDTH, 2.f });
+        gridLine.setPosition({ 0.f, y });
+        target.draw(gridLine);
+    }
+
+    target.draw(m_ground);
+    target.draw(m_groundLine);
+
+    // World pass through the camera (render submission from the ECS, then particles)
+    frame.camera.apply(target);
+    frame.drawList.flush(target);
+    frame.particles.draw(target);
+
+    // HUD pass in screen space (the crash overlay shows its own score)
+    target.setView(m_stack.screenView());
+
+    if (frame.showHud)
+    {
+        updateHud(frame);
+        m_ui.layout(m_stack.screenView().getSize());
+        m_ui.draw(target);
+    }
+
+    Profiler& profiler = Profiler::getInstance();
+    profiler.count(PerfCounter::Particles, frame.particles.size());
+    profiler.count(PerfCounter::Obstacles, frame.obstacles);
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "Scene.hpp"
+#include "Colors.hpp"
+#include "UI.hpp"
+#include "DrawList.hpp"
+#include "DoubleBuffer.hpp"
+#include "DashWorld.hpp"
+
+// What render() needs from one simulated frame
+struct DashFrame
+{
+    DrawList drawList;      // Obstacles, orbs and player, world space
+    ParticleBatch particles;
+    Camera camera;
+    int score = 0;
+    float distance = 0.f;
+    bool showHud = true;    // Hidden once crashed (the overlay shows the result)
+    int obstacles = 0;
+};
+
+// ================= GAME 2 (DASH) =================
+// Auto-scrolling, one-button jump, avoid spikes, collect orbs!
+class DashScene : public Scene
+{
+public:
+    explicit DashScene(SceneStack& stack);
+
+    void enter() override;
+    void resume() override;
+    void handleEvent(const sf::Event& event) override;
+    void sync() override;
+    void update(float dt) override;
+    void render(sf::RenderTarget& target) override;
+
+    bool isAnimating() const override;
+    const char* mode() const override { return "dash"; }
+    const char* name() const override { return "Playing"; }
+
+private:
+    void resetGame();
+    void crash();
+    void pollInput();
+    void writeFrame();
+    void updateHud(const DashFrame& frame);
+
+private:
+    sf::Font* m_font;
+
+    // Simulation (player, obstacles and orbs live in the world's ECS registry)
+    DashWorld m_world;
+    DoubleBuffer<DashFrame> m_frames;   // update() fills back, render() draws front
+
+    sf::RectangleShape m_ground;
+    sf::RectangleShape m_groundLine;
+
+    // HUD: score centred at the top, distance top-right; text rebuilt on change only
+    UIRoot m_ui;
+    Label m_scoreLabel;
+    Label m_distanceLabel;
+    int m_shownScore;
+    int m_shownMeters;
+
+    int m_attempts;
+    bool m_crashed;                 // Run over; set by update()
+    bool m_crashPending;            // sync() still has to push the crash overlay
+    bool m_jumpTapped;
+    bool m_wasMousePressed;
+    bool m_wasSpacePressed;
+};
@@ -0,0 +1,417 @@
+#include "DashWorld.hpp"
+#include "Systems.hpp"
+#include "MemoryTracker.hpp"
+#include "Profiler.hpp"
+#include "Colors.hpp"
+#include "Effects.hpp"
+#include "Physics.hpp"
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+    constexpr float GRAVITY = 2200.f;        // Smoother gravity
+    constexpr float JUMP_FORCE = -750.f;     // Balanced jump
+    constexpr float SCROLL_SPEED_START = 350.f;
+    constexpr float SCROLL_SPEED_MAX = 550.f;
+    constexpr float SPIN_SPEED = 400.f;      // Degrees per second while airborne
+    constexpr float CULL_MARGIN = 100.f;     // How far behind the camera obstacles survive
+    constexpr int COMPACT_THRESHOLD = 64;    // Culled stream entries before compaction
+    constexpr float SAT_STEP = 2.f;          // Max player travel between exact spike tests
+    constexpr float PLAYER_REACH = DashWorld::PLAYER_SIZE * 0.7072f;   // Square's half-diagonal: covers any rotation
+    constexpr float BODY_INSET = 5.f;        // Side forgiveness against block faces and edges
+
+    // Unrotated box the platform physics moves (full height, inset sides)
+    sf::FloatRect bodyBox(sf::Vector2f position)
+    {
+        return { position - sf::Vector2f(DashWorld::PLAYER_SIZE / 2.f - BODY_INSET, DashWorld::PLAYER_SIZE / 2.f),
+                 { DashWorld::PLAYER_SIZE - 2.f * BODY_INSET, DashWorld::PLAYER_SIZE } };
+    }
+}
+
+// ---------------- Constructor ----------------
+DashWorld::DashWorld(sf::Vector2f viewSize, int particleBudget)
+    : m_player(NullEntity), m_firstObstacle(0), m_nextToPass(0), m_firstOrb(0), m_nextSpawnX(0.f),
+      m_particles(particleBudget), m_trail(-1), m_camera(viewSize), m_grounded(true), m_crashed(false), m_invincible(false), m_score(0), m_distance(0.f),
+      m_scrollSpeed(SCROLL_SPEED_START)
+{
+    m_crashFx = m_particles.addEmitter(Effects::pop(Colors::Danger, 40));
+    m_jumpFx = m_particles.addEmitter(Effects::jumpDust());
+    m_orbFx = m_particles.addEmitter(Effects::pop(Colors::Warning, 15));
+    m_trailFx = m_particles.addEmitter(Effects::runTrail());
+    reset();
+}
+
+// ---------------- Spawning ----------------
+void DashWorld::spawnSpike(float x)
+{
+    static const sf::Vector2f pts[3] = { { 0.f, 0.f }, { 20.f, -40.f }, { 40.f, 0.f } };
+
+    Entity e = m_registry.create();
+    m_registry.add<SpikeTag>(e);
+    m_registry.add<Transform>(e).position = { x, GROUND_Y };
+    m_registry.add<Collider>(e, Collider::box({ 0.f, -40.f }, { 40.f, 40.f }));
+    m_registry.add<Hull>(e, Hull::polygon(pts, 3));
+
+    Renderable& r = m_registry.add<Renderable>(e);
+    r.shape = ShapeDesc::polygon(pts, 3, Colors::Danger);
+    r.shape.outlineThickness = 2.f;
+    r.shape.outline = sf::Color(255, 100, 100);
+
+    m_obstacles.push_back(e);
+}
+
+void DashWorld::spawnBlock(float x, float height)
+{
+    Entity e = m_registry.create();
+    m_registry.add<BlockTag>(e);
+    m_registry.add<Transform>(e).position = { x, GROUND_Y };
+    m_registry.add<Collider>(e, Collider::box({ 0.f, -height }, { 50.f, height }));
+
+    Renderable& r = m_registry.add<Renderable>(e);
+    r.shape = ShapeDesc::rectangle({ 50.f, height }, sf::Color(60, 60, 80));
+    r.shape.origin = { 0.f, height };
+    r.shape.outlineThickness = 2.f;
+    r.shape.outline = Colors::Secondary;
+
+    m_obstacles.push_back(e);
+}
+
+void DashWorld::spawnOrb(float x, float y)
+{
+    Entity e = m_registry.create();
+    m_registry.add<OrbTag>(e);
+    m_registry.add<Transform>(e).position = { x, y };
+    m_registry.add<Collider>(e, Collider::box({ 0.f, 0.f }, { 30.f, 30.f }));
+
+    Renderable& r = m_registry.add<Renderable>(e);
+    r.shape = ShapeDesc::circle(15.f, Colors::Warning);
+    r.shape.outlineThickness = 2.f;
+    r.shape.outline = sf::Color(255, 220, 100);
+    r.glow = Glow{ true, sf::Color(255, 200, 50, 50), 6.f, 1.f };
+
+    m_orbs.push_back(e);
+}
+
+// One random obstacle pattern starting at x
+void DashWorld::spawnSection(float x)
+{
+    int type = std::rand() % 5;
+    if (type <= 1)
+    {
+        spawnSpike(x);
+        if (std::rand() % 3 == 0)
+            spawnSpike(x + 45.f);  // Double spike
+    }
+    else if (type == 2)
+    {
+        spawnBlock(x, 40.f + (std::rand() % 40));
+    }
+    else if (type == 3)
+    {
+        spawnSpike(x);
+        spawnOrb(x + 20.f, GROUND_Y - 90.f - (std::rand() % 40));
+    }
+    else
+    {
+        // Triple spike challenge
+        spawnSpike(x);
+        spawnSpike(x + 45.f);
+        spawnSpike(x + 90.f);
+    }
+}
+
+// ---------------- Reset ----------------
+void DashWorld::reset()
+{
+    MemoryScope scope(MemTag::World);
+    m_registry.clear();
+    m_obstacles.clear();
+    m_orbs.clear();
+    m_firstObstacle = 0;
+    m_nextToPass = 0;
+    m_firstOrb = 0;
+    m_particles.clear();
+
+    m_grounded = true;
+    m_crashed = false;
+    m_score = 0;
+    m_distance = 0.f;
+    m_scrollSpeed = SCROLL_SPEED_START;
+    m_camera.setPosition({ 0.f, 0.f });
+
+    // Player - rotating cube like Geometry Dash (origin at centre)
+    m_player = m_registry.create();
+    m_registry.add<PlayerTag>(m_player);
+    m_registry.add<Transform>(m_player).position = { PLAYER_SCREEN_X, GROUND_Y - PLAYER_SIZE / 2.f };
+    m_registry.add<Velocity>(m_player).value = { m_scrollSpeed, 0.f };
+    m_registry.add<Gravity>(m_player).strength = GRAVITY;
+    m_registry.add<Collider>(m_player, Collider::box(
+        { -PLAYER_SIZE / 2.f + 5.f, -PLAYER_SIZE / 2.f + 5.f }, { PLAYER_SIZE - 10.f, PLAYER_SIZE - 10.f }));
+    m_registry.add<Hull>(m_player, Hull::box({ -PLAYER_SIZE / 2.f, -PLAYER_SIZE / 2.f }, { PLAYER_SIZE, PLAYER_SIZE }));
+
+    Renderable& pr = m_registry.add<Renderable>(m_player);
+    pr.shape = ShapeDesc::rectangle({ PLAYER_SIZE, PLAYER_SIZE }, Colors::Player);
+    pr.shape.origin = { PLAYER_SIZE / 2.f, PLAYER_SIZE / 2.f };
+    pr.shape.outlineThickness = 3.f;
+    pr.shape.outline = sf::Color(100, 255, 200);
+    pr.layer = RenderLayer::Front;
+
+    m_trail = m_particles.start(m_trailFx, { PLAYER_SCREEN_X - PLAYER_SIZE / 2.f, GROUND_Y - 4.f });
+
+    // Spawn initial obstacles
+    float x = 600.f;
+    for (int i = 0; i < 5; ++i)
+    {
+        int type = std::rand() % 4;
+        if (type == 0 || type == 1)
+        {
+            spawnSpike(x);
+            if (std::rand() % 2 == 0) // Double spike sometimes
+                spawnSpike(x + 45.f);
+        }
+        else if (type == 2)
+        {
+            spawnBlock(x, 50.f + (std::rand() % 30));
+        }
+        else
+        {
+            spawnSpike(x);
+            spawnOrb(x + 20.f, GROUND_Y - 100.f);
+        }
+        x += 200.f + (std::rand() % 150);
+    }
+}
+
+void DashWorld::crash(sf::Vector2f at)
+{
+    if (m_crashed || m_invincible)
+        return;
+    m_crashed = true;
+    m_registry.get<Renderable>(m_player).visible = false;
+    m_particles.burst(m_crashFx, at);
+    m_particles.stop(m_trail);
+    m_trail = -1;
+    std::cout << ">>> CRASHED! Score: " << m_score << ", Distance: " << (int)(m_distance / 10.f) << "m <<<\n";
+}
+
+// ---------------- Update ----------------
+void DashWorld::update(float dt, const PlayerInput& input)
+{
+    MemoryScope scope(MemTag::World);
+
+    if (!m_crashed)
+    {
+        Transform& pt = m_registry.get<Transform>(m_player);
+        Velocity& pv = m_registry.get<Velocity>(m_player);
+
+        // Jump on tap
+        if (input.jump && m_grounded)
+        {
+            pv.value.y = JUMP_FORCE;
+            m_grounded = false;
+            m_particles.burst(m_jumpFx, pt.position + sf::Vector2f(0.f, PLAYER_SIZE / 2.f));
+        }
+
+        // Increase speed over time; the player runs, the world stays put
+        m_scrollSpeed = std::min(SCROLL_SPEED_MAX, SCROLL_SPEED_START + m_distance * 0.02f);
+        pv.value.x = m_scrollSpeed;
+        m_distance += m_scrollSpeed * dt;
+
+        // Pose before the move; collision sweeps it to where the frame ends
+        Transform startPose = pt;
+        sf::FloatRect startBox = Collision::toWorld(pt, m_registry.get<Collider>(m_player)).box;
+
+        Systems::gravity(m_registry, dt);
+        Systems::movement(m_registry, dt);
+        Systems::lifetime(m_registry, dt);
+
+        // Platform physics against the ground and nearby blocks: landing on
+        // either grounds the player, a block's side stops it (crash below)
+        sf::FloatRect fromBody = bodyBox(startPose.position);
+        sf::FloatRect toBody = bodyBox(pt.position);
+        float minX = std::min(fromBody.position.x, toBody.position.x);
+        float maxX = std::max(fromBody.position.x, toBody.position.x) + fromBody.size.x;
+
+        m_platforms.clear();
+        m_platforms.push_back({ { { minX - PLAYER_SIZE, GROUND_Y }, { maxX - minX + 2.f * PLAYER_SIZE, PLAYER_SIZE } } });
+        std::uint8_t blockFlags = m_invincible ? Physics::PlatformOneWay : Physics::PlatformSolid;
+        for (int i = m_firstObstacle; i < m_obstacles.size(); ++i)
+        {
+            Entity e = m_obstacles[i];
+            const Transform& t = m_registry.get<Transform>(e);
+            if (t.position.x > maxX)
+                break;
+            if (!m_registry.has<BlockTag>(e))
+                continue;
+
+            sf::FloatRect box = Collision::toWorld(t, m_registry.get<Collider>(e)).box;
+            if (box.position.x + box.size.x >= minX)
+                m_platforms.push_back({ box, blockFlags });
+        }
+
+        Physics::Contacts contacts = Physics::resolve(fromBody, toBody, pv.value, m_platforms.data(), m_platforms.size());
+        pt.position = toBody.position + sf::Vector2f(PLAYER_SIZE / 2.f - BODY_INSET, PLAYER_SIZE / 2.f);
+        m_grounded = contacts.grounded();
+
+        // Snap rotation to nearest 90 degrees on landing
+        if (m_grounded)
+            pt.rotation = std::round(pt.rotation / 90.f) * 90.f;
+
+        // Rotate while in air
+        if (!m_grounded)
+            pt.rotation += SPIN_SPEED * dt;
+
+        // Camera follows the player's world x
+        m_camera.setPosition({ pt.position.x - PLAYER_SCREEN_X, 0.f });
+
+        // Trail sheds from the cube's trailing bottom corner
+        m_particles.moveEmitter(m_trail, pt.position + sf::Vector2f(-PLAYER_SIZE / 2.f, PLAYER_SIZE / 2.f - 4.f));
+
+        // Spawn new obstacles ahead of the camera
+        float rightmost = m_obstacles.size() > 0 ? streamX(m_obstacles, m_obstacles.size() - 1) : 0.f;
+        while (rightmost < m_camera.getRight() + 400.f)
+        {
+            float newX = rightmost + 180.f + (std::rand() % 120);
+            spawnSection(newX);
+            rightmost = newX + 50.f;
+        }
+
+        // Spawning can grow the Transform pool and culling swap-and-pops it,
+        // so the pt reference above must not be used past this point; the
+        // rest of the update reads a copy of the pose
+        const Transform player = m_registry.get<Transform>(m_player);
+
+        // Score for passing obstacles (sorted, so just advance an index)
+        while (m_nextToPass < m_obstacles.size() && streamX(m_obstacles, m_nextToPass) < player.position.x - 20.f)
+        {
+            if (m_registry.has<SpikeTag>(m_obstacles[m_nextToPass]))
+                m_score += 1;
+            m_nextToPass++;
+        }
+
+        // Cull entities that fell behind the camera
+        float cullX = m_camera.getLeft() - CULL_MARGIN;
+        while (m_firstObstacle < m_nextToPass && streamX(m_obstacles, m_firstObstacle) < cullX)
+            m_registry.destroy(m_obstacles[m_firstObstacle++]);
+        while (m_firstOrb < m_orbs.size() && streamX(m_orbs, m_firstOrb) < cullX + 50.f)
+            m_registry.destroy(m_orbs[m_firstOrb++]);
+
+        // Compact occasionally so the streams don't grow over a long run
+        if (m_firstObstacle >= COMPACT_THRESHOLD)
+        {
+            m_obstacles.eraseFront(m_firstObstacle);
+            m_nextToPass -= m_firstObstacle;
+            m_firstObstacle = 0;
+        }
+        if (m_firstOrb >= COMPACT_THRESHOLD)
+        {
+            m_orbs.eraseFront(m_firstOrb);
+            m_firstOrb = 0;
+        }
+
+        // Spike and orb detection (world space, only obstacles near the player).
+        // Everything is swept over the whole move, so a long frame or top
+        // speed can't carry the player past a spike narrower than one step
+        ProfileScope profile(ProfileSection::Collision);
+        sf::FloatRect endBox = Collision::toWorld(player, m_registry.get<Collider>(m_player)).box;
+        sf::Vector2f delta = endBox.position - startBox.position;
+        float sweptRight = std::max(startPose.position.x, player.position.x) + PLAYER_REACH;
+
+        // Running into a block's side ends the (already shortened) move
+        float crashTime = contacts.wall >= 0 ? 1.f : 2.f;   // Earliest fatal contact, as a fraction of the move
+        for (int i = m_firstObstacle; i < m_obstacles.size(); ++i)
+        {
+            Entity e = m_obstacles[i];
+            Transform& t = m_registry.get<Transform>(e);
+            if (t.position.x > sweptRight)
+                break;
+
+            if (m_registry.has<SpikeTag>(e))
+                crashTime = std::min(crashTime, spikeContact(startPose, player, e));
+        }
+
+        if (crashTime <= 1.f && !m_invincible)
+        {
+            // Back the player up to the point of contact
+            Transform& body = m_registry.get<Transform>(m_player);
+            body.position -= delta * (1.f - crashTime);
+            crash(body.position);
+        }
+
+        // Collect orbs anywhere along the move
+        for (int i = m_firstOrb; i < m_orbs.size() && !m_crashed; ++i)
+        {
+            Entity e = m_orbs[i];
+            Transform& t = m_registry.get<Transform>(e);
+            if (t.position.x > sweptRight)
+                break;
+
+            Collision::SweepHit hit;
+            Collider* c = m_registry.tryGet<Collider>(e);
+            if (c && Collision::sweepAabb(startBox, delta, Collision::toWorld(t, *c).box, hit))
+            {
+                m_score += 5;
+                m_particles.burst(m_orbFx, t.position + sf::Vector2f(15.f, 15.f));
+                m_registry.get<Renderable>(e).visible = false;
+                m_registry.remove<Collider>(e);
+            }
+        }
+    }
+
+    m_particles.update(dt);
+}
+
+// Earliest fraction of the move at which the player's square touches the
+// spike's triangle, or 2 when it doesn't. The swept bounds give the window
+// in which contact is possible (most pairs stop there); inside it the exact
+// outlines are compared by SAT every SAT_STEP of travel, with the rotation
+// interpolated along the move.
+float DashWorld::spikeContact(const Transform& from, const Transform& to, Entity spike)
+{
+    Collision::WorldHull spikeHull = Collision::toWorld(m_registry.get<Transform>(spike), m_registry.get<Hull>(spike));
+
+    sf::FloatRect reach(from.position - sf::Vector2f(PLAYER_REACH, PLAYER_REACH), { 2.f * PLAYER_REACH, 2.f * PLAYER_REACH });
+    sf::Vector2f delta = to.position - from.position;
+    Collision::SweepHit hit;
+    if (!Collision::sweepAabb(reach, delta, spikeHull.bounds, hit))
+        return 2.f;
+
+    float span = std::min(hit.exitTime, 1.f) - hit.time;
+    float travel = std::sqrt(delta.x * delta.x + delta.y * delta.y) * span;
+    int steps = std::max(1, static_cast<int>(std::ceil(travel / SAT_STEP)));
+
+    const Hull& shape = m_registry.get<Hull>(m_player);
+    Transform pose = to;
+    for (int k = 0; k <= steps; ++k)
+    {
+        float time = hit.time + span * k / steps;
+        pose.position = from.position + delta * time;
+        pose.rotation = from.rotation + (to.rotation - from.rotation) * time;
+        if (Collision::hullOverlap(Collision::toWorld(pose, shape), spikeHull))
+            return time;
+    }
+    return 2.f;
+}
+
+// ---------------- Render Submission ----------------
+void DashWorld::submit(DrawList& list)
+{
+    if (!m_crashed)
+    {
+        // Fading trail behind the cube
+        const Transform& pt = m_registry.get<Transform>(m_player);
+        for (int i = 3; i >= 1; --i)
+        {
+            float size = PLAYER_SIZE - i * 4.f;
+            ShapeDesc trail = ShapeDesc::rectangle({ size, size },
+                sf::Color(Colors::Player.r, Colors::Player.g, Colors::Player.b, static_cast<std::uint8_t>(80 - i * 20)));
+            trail.origin = { size / 2.f, size / 2.f };
+            list.submit(trail, { pt.position.x - i * 15.f, pt.position.y }, pt.rotation - i * 15.f,
+                { 1.f, 1.f }, RenderLayer::Front);
+        }
+    }
+
+    Systems::render(m_registry, list, m_camera.getVisibleArea());
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "ECS.hpp"
+#include "Components.hpp"
+#include "DrawList.hpp"
+#include "Camera.hpp"
+#include "Particles.hpp"
+#include "Physics.hpp"
+#include "InputManager.hpp"
+
+// ================= DASH SIMULATION =================
+// Auto-runner state in an ECS registry. The player runs right through a
+// static world and the camera follows; obstacles and orbs are kept in
+// spawn-ordered streams (sorted by x) so culling is an index advance.
+class DashWorld
+{
+public:
+    static constexpr float GROUND_Y = 480.f;
+    static constexpr float PLAYER_SIZE = 40.f;
+    static constexpr float PLAYER_SCREEN_X = 100.f;   // Player's fixed column on screen
+    static constexpr int PARTICLE_BUDGET = 1024;
+
+    DashWorld(sf::Vector2f viewSize, int particleBudget = PARTICLE_BUDGET);
+
+    void reset();
+    void update(float dt, const PlayerInput& input);
+    void submit(DrawList& list);
+
+    bool isCrashed() const { return m_crashed; }
+    int getScore() const { return m_score; }
+    float getDistance() const { return m_distance; }
+    float getScrollSpeed() const { return m_scrollSpeed; }
+    int getObstacleCount() const { return m_obstacles.size() - m_firstObstacle; }
+
+    // Obstacles stop crashing the player (scripted long runs)
+    void setInvincible(bool invincible) { m_invincible = invincible; }
+
+    Camera& getCamera() { return m_camera; }
+    ParticleSystem& getParticles() { return m_particles; }
+    const ParticleSystem& getParticles() const { return m_particles; }
+    Registry& getRegistry() { return m_registry; }
+
+private:
+    void spawnSpike(float x);
+    void spawnBlock(float x, float height);
+    void spawnOrb(float x, float y);
+    void spawnSection(float x);
+    void crash(sf::Vector2f at);
+    float spikeContact(const Transform& from, const Transform& to, Entity spike);
+
+    float streamX(const DynamicArray<Entity>& stream, int i) { return m_registry.get<Transform>(stream[i]).position.x; }
+
+    Registry m_registry;
+    Entity m_player;
+
+    // Spawn-ordered entity streams (world x ascending)
+    DynamicArray<Entity> m_obstacles;
+    DynamicArray<Entity> m_orbs;
+    int m_firstObstacle;     // First obstacle not yet culled
+    int m_nextToPass;        // First obstacle the player has not passed
+    int m_firstOrb;
+    float m_nextSpawnX;      // World x of the next spawn slot
+    DynamicArray<Physics::Platform> m_platforms;    // Ground and nearby blocks, rebuilt each update
+
+    ParticleSystem m_particles;
+    int m_crashFx;          // Emitter ids
+    int m_jumpFx;
+    int m_orbFx;
+    int m_trailFx;
+    int m_trail;            // Running trail emitter handle
+    Camera m_camera;
+
+    bool m_grounded;
+    bool m_crashed;
+    bool m_invincible;
+    int m_score;
+    float m_distance;
+    float m_scrollSpeed;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+// ================= DOUBLE BUFFER =================
+// Two instances of T for a producer and a consumer that never share one:
+// the simulation fills back(), the renderer reads front(), and swap()
+// publishes the back buffer. swap() must only run while neither side is
+// working (between frames). A swap with nothing written keeps the current
+// front, so a paused producer leaves its last frame on screen.
+template<typename T>
+class DoubleBuffer
+{
+public:
+    // Producer side; marks the buffer as holding a new frame
+    T& back()
+    {
+        m_written = true;
+        return m_buffers[1 - m_front];
+    }
+
+    // Consumer side
+    T& front() { return m_buffers[m_front]; }
+    const T& front() const { return m_buffers[m_front]; }
+
+    // Setup only, while neither side is running (e.g. preallocating both)
+    T& operator[](int index) { return m_buffers[index]; }
+
+    // Returns false when no new frame was written since the last swap
+    bool swap()
+    {
+        if (!m_written)
+            return false;
+        m_front = 1 - m_front;
+        m_written = false;
+        return true;
+    }
+
+private:
+    T m_buffers[2];
+    int m_front = 0;
+    bool m_written = false;
+};
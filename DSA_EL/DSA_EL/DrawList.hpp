@@ -0,0 +1,178 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "DynamicArray.hpp"
+#include "Profiler.hpp"
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
+
+// ================= SHAPE DESCRIPTION =================
+// Plain-data description of an SFML shape, so entities don't each own an sf::Shape
+enum class ShapeKind : std::uint8_t
+{
+    Rectangle,
+    Circle,
+    Polygon
+};
+
+constexpr int MAX_SHAPE_POINTS = 10;
+
+struct ShapeDesc
+{
+    ShapeKind kind = ShapeKind::Rectangle;
+    sf::Vector2f size;                            // Rectangle
+    float radius = 0.f;                           // Circle
+    int pointCount = 0;                           // Polygon
+    sf::Vector2f points[MAX_SHAPE_POINTS];
+    sf::Vector2f origin;
+    sf::Color fill = sf::Color::White;
+    sf::Color outline = sf::Color::Transparent;
+    float outlineThickness = 0.f;
+
+    static ShapeDesc rectangle(sf::Vector2f size, sf::Color fill)
+    {
+        ShapeDesc s;
+        s.kind = ShapeKind::Rectangle;
+        s.size = size;
+        s.fill = fill;
+        return s;
+    }
+
+    static ShapeDesc circle(float radius, sf::Color fill)
+    {
+        ShapeDesc s;
+        s.kind = ShapeKind::Circle;
+        s.radius = radius;
+        s.fill = fill;
+        return s;
+    }
+
+    static ShapeDesc polygon(const sf::Vector2f* pts, int count, sf::Color fill)
+    {
+        ShapeDesc s;
+        s.kind = ShapeKind::Polygon;
+        s.pointCount = std::min(count, MAX_SHAPE_POINTS);
+        for (int i = 0; i < s.pointCount; ++i)
+            s.points[i] = pts[i];
+        s.fill = fill;
+        return s;
+    }
+
+    // Largest distance from the origin to any part of the shape (for culling)
+    float extent() const
+    {
+        float r = 0.f;
+        if (kind == ShapeKind::Rectangle)
+            r = std::max(size.x, size.y);
+        else if (kind == ShapeKind::Circle)
+            r = radius * 2.f;
+        else
+            for (int i = 0; i < pointCount; ++i)
+                r = std::max(r, std::max(std::abs(points[i].x), std::abs(points[i].y)));
+        return r + std::max(std::abs(origin.x), std::abs(origin.y)) + outlineThickness;
+    }
+};
+
+// ================= DRAW LIST =================
+enum class RenderLayer : std::uint8_t
+{
+    Back,
+    Middle,
+    Front,
+    Count
+};
+
+struct DrawCommand
+{
+    ShapeDesc shape;
+    sf::Vector2f position;
+    float rotation = 0.f;
+    sf::Vector2f scale{ 1.f, 1.f };
+};
+
+// Systems submit commands; flush() draws them layer by layer through a
+// handful of reused sf::Shape objects. Capacity is kept across frames.
+// A DrawList is plain data until flush(), so it can be filled on the
+// simulation thread and drawn on the render thread (see DoubleBuffer).
+class DrawList
+{
+public:
+    void submit(const ShapeDesc& shape, sf::Vector2f position, float rotation = 0.f,
+        sf::Vector2f scale = { 1.f, 1.f }, RenderLayer layer = RenderLayer::Middle)
+    {
+        DrawCommand cmd;
+        cmd.shape = shape;
+        cmd.position = position;
+        cmd.rotation = rotation;
+        cmd.scale = scale;
+        m_layers[static_cast<int>(layer)].push_back(cmd);
+    }
+
+    void clear()
+    {
+        for (int i = 0; i < LAYER_COUNT; ++i)
+            m_layers[i].clear();
+    }
+
+    int size() const
+    {
+        int n = 0;
+        for (int i = 0; i < LAYER_COUNT; ++i)
+            n += m_layers[i].size();
+        return n;
+    }
+
+    void flush(sf::RenderTarget& target)
+    {
+        for (int l = 0; l < LAYER_COUNT; ++l)
+            for (int i = 0; i < m_layers[l].size(); ++i)
+                draw(target, m_layers[l][i]);
+        Profiler::getInstance().count(PerfCounter::DrawCalls, size());
+    }
+
+private:
+    void draw(sf::RenderTarget& target, const DrawCommand& cmd)
+    {
+        const ShapeDesc& s = cmd.shape;
+        sf::Shape* shape = nullptr;
+
+        // Setters that rebuild geometry are skipped when the value repeats
+        // (runs of particles or same-size obstacles)
+        if (s.kind == ShapeKind::Rectangle)
+        {
+            if (m_rect.getSize() != s.size)
+                m_rect.setSize(s.size);
+            shape = &m_rect;
+        }
+        else if (s.kind == ShapeKind::Circle)
+        {
+            if (m_circle.getRadius() != s.radius)
+                m_circle.setRadius(s.radius);
+            shape = &m_circle;
+        }
+        else
+        {
+            m_polygon.setPointCount(static_cast<std::size_t>(s.pointCount));
+            for (int i = 0; i < s.pointCount; ++i)
+                m_polygon.setPoint(static_cast<std::size_t>(i), s.points[i]);
+            shape = &m_polygon;
+        }
+
+        shape->setOrigin(s.origin);
+        shape->setPosition(cmd.position);
+        shape->setRotation(sf::degrees(cmd.rotation));
+        shape->setScale(cmd.scale);
+        shape->setFillColor(s.fill);
+        shape->setOutlineColor(s.outline);
+        if (shape->getOutlineThickness() != s.outlineThickness)
+            shape->setOutlineThickness(s.outlineThickness);
+        target.draw(*shape);
+    }
+
+    static constexpr int LAYER_COUNT = static_cast<int>(RenderLayer::Count);
+
+    DynamicArray<DrawCommand> m_layers[LAYER_COUNT];
+    sf::RectangleShape m_rect;
+    sf::CircleShape m_circle;
+    sf::ConvexShape m_polygon;
+};
@@ -1,24 +1,65 @@
 #pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
 
-template <typename T>
+// Default storage policy: the global heap
+struct HeapArrayAllocator
+{
+    void* allocate(std::size_t bytes, std::size_t align)
+    {
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator new(bytes, std::align_val_t(align));
+        return ::operator new(bytes);
+    }
+
+    void deallocate(void* ptr, std::size_t, std::size_t align)
+    {
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            ::operator delete(ptr, std::align_val_t(align));
+        else
+            ::operator delete(ptr);
+    }
+};
+
+// Heap storage starting on a cache-line boundary, for arrays that are
+// split into per-thread ranges (no two threads write the same line)
+struct CacheLineAllocator
+{
+    static constexpr std::size_t LINE = 64;
+
+    void* allocate(std::size_t bytes, std::size_t align)
+    {
+        return HeapArrayAllocator().allocate(bytes, align > LINE ? align : LINE);
+    }
+
+    void deallocate(void* ptr, std::size_t bytes, std::size_t align)
+    {
+        HeapArrayAllocator().deallocate(ptr, bytes, align > LINE ? align : LINE);
+    }
+};
+
+// Growable array. Storage comes from an allocator policy (heap by default,
+// or e.g. ArenaArrayAllocator for per-frame scratch arrays); only the first
+// size() slots hold constructed elements.
+template <typename T, typename Allocator = HeapArrayAllocator>
 class DynamicArray
 {
 public:
-    DynamicArray()
-        : m_data(nullptr), m_size(0), m_capacity(0) {
+    DynamicArray(Allocator alloc = Allocator())
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(alloc) {
     }
 
     // Copy constructor
     DynamicArray(const DynamicArray& other)
-        : m_data(nullptr), m_size(0), m_capacity(0)
+        : m_data(nullptr), m_size(0), m_capacity(0), m_alloc(other.m_alloc)
     {
         if (other.m_size > 0)
         {
-            m_capacity = other.m_capacity;
+            reserve(other.m_capacity);
+            for (int i = 0; i < other.m_size; ++i)
+                new (&m_data[i]) T(other.m_data[i]);
             m_size = other.m_size;
-            m_data = new T[m_capacity];
-            for (int i = 0; i < m_size; ++i)
-                m_data[i] = other.m_data[i];
         }
     }
 
@@ -27,34 +68,62 @@ public:
     {
         if (this != &other)
         {
-            delete[] m_data;
-            m_data = nullptr;
-            m_size = 0;
-            m_capacity = 0;
+            release();
+            m_alloc = other.m_alloc;
 
             if (other.m_size > 0)
             {
-                m_capacity = other.m_capacity;
+                reserve(other.m_capacity);
+                for (int i = 0; i < other.m_size; ++i)
+                    new (&m_data[i]) T(other.m_data[i]);
                 m_size = other.m_size;
-                m_data = new T[m_capacity];
-                for (int i = 0; i < m_size; ++i)
-                    m_data[i] = other.m_data[i];
             }
         }
         return *this;
     }
 
+    // Move constructor / assignment steal the buffer
+    DynamicArray(DynamicArray&& other) noexcept
+        : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity), m_alloc(other.m_alloc)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+
+    DynamicArray& operator=(DynamicArray&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            m_alloc = other.m_alloc;
+            other.m_data = nullptr;
+            other.m_size = 0;
+            other.m_capacity = 0;
+        }
+        return *this;
+    }
+
     ~DynamicArray()
     {
-        delete[] m_data;
+        release();
     }
 
     void push_back(const T& value)
     {
         if (m_size >= m_capacity)
-            resize();
+        {
+            // value may live in this array, so copy it before growing
+            T copy(value);
+            grow();
+            new (&m_data[m_size++]) T(std::move(copy));
+            return;
+        }
 
-        m_data[m_size++] = value;
+        new (&m_data[m_size++]) T(value);
     }
 
     T& operator[](int index)
@@ -72,27 +141,111 @@ public:
         return m_size;
     }
 
-    void clear()
+    int capacity() const
     {
-        m_size = 0;
+        return m_capacity;
     }
 
-private:
-    void resize()
+    void pop_back()
+    {
+        if (m_size > 0)
+            m_data[--m_size].~T();
+    }
+
+    T& back()
+    {
+        return m_data[m_size - 1];
+    }
+
+    // Contiguous storage (valid until the next push_back)
+    T* data()
+    {
+        return m_data;
+    }
+
+    const T* data() const
+    {
+        return m_data;
+    }
+
+    // Make room for `capacity` elements up front
+    void reserve(int capacity)
     {
-        int newCapacity = (m_capacity == 0) ? 2 : m_capacity * 2;
-        T* newData = new T[newCapacity];
+        if (capacity <= m_capacity)
+            return;
 
+        T* newData = static_cast<T*>(m_alloc.allocate(sizeof(T) * capacity, alignof(T)));
         for (int i = 0; i < m_size; ++i)
-            newData[i] = m_data[i];
+        {
+            new (&newData[i]) T(std::move(m_data[i]));
+            m_data[i].~T();
+        }
 
-        delete[] m_data;
+        if (m_data)
+            m_alloc.deallocate(m_data, sizeof(T) * m_capacity, alignof(T));
         m_data = newData;
-        m_capacity = newCapacity;
+        m_capacity = capacity;
+    }
+
+    void clear()
+    {
+        for (int i = 0; i < m_size; ++i)
+            m_data[i].~T();
+        m_size = 0;
+    }
+
+    // Drop the first `count` elements, shifting the rest down (keeps capacity)
+    void eraseFront(int count)
+    {
+        if (count <= 0)
+            return;
+        if (count >= m_size)
+        {
+            clear();
+            return;
+        }
+
+        for (int i = count; i < m_size; ++i)
+            m_data[i - count] = std::move(m_data[i]);
+        for (int i = m_size - count; i < m_size; ++i)
+            m_data[i].~T();
+        m_size -= count;
+    }
+
+    // Keep only the first `count` elements
+    void truncate(int count)
+    {
+        while (m_size > count)
+            m_data[--m_size].~T();
+    }
+
+    // Exactly `count` elements; new slots are value-initialised
+    void resize(int count)
+    {
+        reserve(count);
+        while (m_size < count)
+            new (&m_data[m_size++]) T();
+        truncate(count);
+    }
+
+private:
+    void grow()
+    {
+        reserve((m_capacity == 0) ? 2 : m_capacity * 2);
+    }
+
+    void release()
+    {
+        clear();
+        if (m_data)
+            m_alloc.deallocate(m_data, sizeof(T) * m_capacity, alignof(T));
+        m_data = nullptr;
+        m_capacity = 0;
     }
 
 private:
     T* m_data;
     int m_size;
     int m_capacity;
+    Allocator m_alloc;
 };
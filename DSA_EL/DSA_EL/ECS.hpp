@@ -0,0 +1,304 @@
+#pragma once
+#include "DynamicArray.hpp"
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+
+// ================= ENTITY =================
+// Handle = 20-bit slot index + 12-bit generation, so stale handles are detected
+using Entity = std::uint32_t;
+constexpr Entity NullEntity = 0xFFFFFFFFu;
+
+namespace EntityId
+{
+    constexpr std::uint32_t INDEX_BITS = 20;
+    constexpr std::uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+    constexpr std::uint32_t GENERATION_MASK = 0xFFFu;
+
+    inline std::uint32_t index(Entity e) { return e & INDEX_MASK; }
+    inline std::uint32_t generation(Entity e) { return (e >> INDEX_BITS) & GENERATION_MASK; }
+    inline Entity make(std::uint32_t index, std::uint32_t generation)
+    {
+        return (generation << INDEX_BITS) | index;
+    }
+}
+
+// ================= COMPONENT POOL (SPARSE SET) =================
+// Components of one type live in a dense contiguous array; a sparse
+// index maps entity slot -> dense slot. Removal is swap-and-pop.
+class IComponentPool
+{
+public:
+    virtual ~IComponentPool() = default;
+    virtual void remove(Entity e) = 0;
+    virtual void clear() = 0;
+};
+
+template<typename T>
+class ComponentPool : public IComponentPool
+{
+public:
+    T& add(Entity e, const T& component)
+    {
+        std::uint32_t idx = EntityId::index(e);
+        while (m_sparse.size() <= static_cast<int>(idx))
+            m_sparse.push_back(-1);
+
+        int slot = m_sparse[idx];
+        if (slot >= 0)
+        {
+            m_components[slot] = component;
+            return m_components[slot];
+        }
+
+        m_sparse[idx] = m_entities.size();
+        m_entities.push_back(e);
+        m_components.push_back(component);
+        return m_components.back();
+    }
+
+    // No-op for a stale handle, even when its slot was recycled
+    void remove(Entity e) override
+    {
+        if (!has(e))
+            return;
+        std::uint32_t idx = EntityId::index(e);
+
+        int slot = m_sparse[idx];
+        int last = m_entities.size() - 1;
+        if (slot != last)
+        {
+            m_entities[slot] = m_entities[last];
+            m_components[slot] = m_components[last];
+            m_sparse[EntityId::index(m_entities[slot])] = slot;
+        }
+        m_entities.pop_back();
+        m_components.pop_back();
+        m_sparse[idx] = -1;
+    }
+
+    bool has(Entity e) const
+    {
+        std::uint32_t idx = EntityId::index(e);
+        return static_cast<int>(idx) < m_sparse.size() && m_sparse[idx] >= 0 &&
+            m_entities[m_sparse[idx]] == e;
+    }
+
+    T& get(Entity e)
+    {
+        assert(has(e) && "ComponentPool::get on a missing component or stale handle");
+        return m_components[m_sparse[EntityId::index(e)]];
+    }
+
+    void clear() override
+    {
+        for (int i = 0; i < m_entities.size(); ++i)
+            m_sparse[EntityId::index(m_entities[i])] = -1;
+        m_entities.clear();
+        m_components.clear();
+    }
+
+    int size() const { return m_entities.size(); }
+    Entity entityAt(int i) const { return m_entities[i]; }
+    T& componentAt(int i) { return m_components[i]; }
+
+private:
+    DynamicArray<int> m_sparse;        // entity slot -> dense slot (-1 = absent)
+    DynamicArray<Entity> m_entities;   // dense slot -> entity
+    DynamicArray<T> m_components;      // dense slot -> component (contiguous)
+};
+
+// ================= VIEW =================
+// Iterates entities owning every listed component. The first pool drives
+// the loop, so put the rarest component first. Inside each(), destroy
+// entities with Registry::destroyLater() rather than destroy().
+template<typename First, typename... Rest>
+class View
+{
+public:
+    View(ComponentPool<First>* first, ComponentPool<Rest>*... rest)
+        : m_first(first), m_rest(rest...)
+    {
+    }
+
+    template<typename Fn>
+    void each(Fn fn)
+    {
+        for (int i = 0; i < m_first->size(); ++i)
+        {
+            Entity e = m_first->entityAt(i);
+            if (hasRest(e))
+                fn(e, m_first->componentAt(i), std::get<ComponentPool<Rest>*>(m_rest)->get(e)...);
+        }
+    }
+
+    int count()
+    {
+        int n = 0;
+        for (int i = 0; i < m_first->size(); ++i)
+            if (hasRest(m_first->entityAt(i)))
+                n++;
+        return n;
+    }
+
+private:
+    bool hasRest(Entity e) const
+    {
+        (void)e;
+        return (std::get<ComponentPool<Rest>*>(m_rest)->has(e) && ...);
+    }
+
+    ComponentPool<First>* m_first;
+    std::tuple<ComponentPool<Rest>*...> m_rest;
+};
+
+// ================= REGISTRY =================
+class Registry
+{
+public:
+    static constexpr int MAX_COMPONENTS = 32;
+
+    Registry() : m_alive(0) {}
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    Entity create()
+    {
+        std::uint32_t idx;
+        if (m_freeIndices.size() > 0)
+        {
+            idx = m_freeIndices.back();
+            m_freeIndices.pop_back();
+        }
+        else
+        {
+            idx = static_cast<std::uint32_t>(m_generations.size());
+            assert(idx <= EntityId::INDEX_MASK && "Registry: more entity slots than INDEX_BITS can address");
+            m_generations.push_back(0);
+        }
+        m_alive++;
+        return EntityId::make(idx, m_generations[idx]);
+    }
+
+    void destroy(Entity e)
+    {
+        if (!alive(e))
+            return;
+
+        for (int i = 0; i < MAX_COMPONENTS; ++i)
+            if (m_pools[i])
+                m_pools[i]->remove(e);
+
+        std::uint32_t idx = EntityId::index(e);
+        m_generations[idx] = static_cast<std::uint16_t>((m_generations[idx] + 1) & EntityId::GENERATION_MASK);
+        m_freeIndices.push_back(idx);
+        m_alive--;
+    }
+
+    // Deferred destruction, safe while iterating a view
+    void destroyLater(Entity e)
+    {
+        m_pendingDestroy.push_back(e);
+    }
+
+    void flushDestroyed()
+    {
+        for (int i = 0; i < m_pendingDestroy.size(); ++i)
+            destroy(m_pendingDestroy[i]);
+        m_pendingDestroy.clear();
+    }
+
+    bool alive(Entity e) const
+    {
+        std::uint32_t idx = EntityId::index(e);
+        return e != NullEntity && static_cast<int>(idx) < m_generations.size() &&
+            m_generations[idx] == EntityId::generation(e);
+    }
+
+    // Remove every entity but keep pool capacity for the next session
+    void clear()
+    {
+        for (int i = 0; i < MAX_COMPONENTS; ++i)
+            if (m_pools[i])
+                m_pools[i]->clear();
+
+        m_freeIndices.clear();
+        for (int i = m_generations.size() - 1; i >= 0; --i)
+        {
+            m_generations[i] = static_cast<std::uint16_t>((m_generations[i] + 1) & EntityId::GENERATION_MASK);
+            m_freeIndices.push_back(static_cast<std::uint32_t>(i));
+        }
+        m_pendingDestroy.clear();
+        m_alive = 0;
+    }
+
+    int aliveCount() const { return m_alive; }
+
+    template<typename T>
+    T& add(Entity e, const T& component = T())
+    {
+        return pool<T>().add(e, component);
+    }
+
+    template<typename T>
+    void remove(Entity e)
+    {
+        pool<T>().remove(e);
+    }
+
+    template<typename T>
+    bool has(Entity e)
+    {
+        return pool<T>().has(e);
+    }
+
+    template<typename T>
+    T& get(Entity e)
+    {
+        return pool<T>().get(e);
+    }
+
+    template<typename T>
+    T* tryGet(Entity e)
+    {
+        ComponentPool<T>& p = pool<T>();
+        return p.has(e) ? &p.get(e) : nullptr;
+    }
+
+    template<typename T>
+    ComponentPool<T>& pool()
+    {
+        int id = componentId<T>();
+        if (!m_pools[id])
+            m_pools[id] = std::make_unique<ComponentPool<T>>();
+        return *static_cast<ComponentPool<T>*>(m_pools[id].get());
+    }
+
+    template<typename First, typename... Rest>
+    View<First, Rest...> view()
+    {
+        return View<First, Rest...>(&pool<First>(), &pool<Rest>()...);
+    }
+
+private:
+    static int nextComponentId()
+    {
+        static int counter = 0;
+        return counter++;
+    }
+
+    template<typename T>
+    static int componentId()
+    {
+        static int id = nextComponentId();
+        assert(id < MAX_COMPONENTS && "Registry: more component types than MAX_COMPONENTS");
+        return id;
+    }
+
+    std::unique_ptr<IComponentPool> m_pools[MAX_COMPONENTS];
+    DynamicArray<std::uint16_t> m_generations;
+    DynamicArray<std::uint32_t> m_freeIndices;
+    DynamicArray<Entity> m_pendingDestroy;
+    int m_alive;
+};
@@ -0,0 +1,66 @@
+#pragma once
+#include "Particles.hpp"
+#include "Colors.hpp"
+
+// ================= EFFECTS =================
+// Emitter definitions used by the game worlds. Each world registers the
+// ones it needs with its ParticleSystem when it is constructed.
+namespace Effects
+{
+    // Radial pop that kicks upward, then falls and fades to half colour
+    inline EmitterConfig pop(sf::Color color, int count)
+    {
+        EmitterConfig c;
+        c.burst = count;
+        c.spread = 360.f;
+        c.speedMin = 50.f;
+        c.speedMax = 200.f;
+        c.velocityOffset = { 0.f, -100.f };
+        c.lifeMin = 0.5f;
+        c.lifeMax = 1.f;
+        c.colorStart = color;
+        c.colorEnd = sf::Color(color.r / 2, color.g / 2, color.b / 2, 0);
+        c.gravity = 200.f;
+        return c;
+    }
+
+    // Dust kicked down and back off the ground on a jump
+    inline EmitterConfig jumpDust()
+    {
+        EmitterConfig c;
+        c.burst = 8;
+        c.direction = 135.f;
+        c.spread = 70.f;
+        c.speedMin = 60.f;
+        c.speedMax = 160.f;
+        c.lifeMin = 0.3f;
+        c.lifeMax = 0.5f;
+        c.sizeStart = 7.f;
+        c.sizeEnd = 2.f;
+        c.colorStart = Colors::Player;
+        c.colorEnd = sf::Color(Colors::Player.r, Colors::Player.g, Colors::Player.b, 0);
+        c.gravity = 300.f;
+        c.drag = 3.f;
+        return c;
+    }
+
+    // Continuous trail shed behind the running player
+    inline EmitterConfig runTrail()
+    {
+        EmitterConfig c;
+        c.rate = 40.f;
+        c.direction = 180.f;
+        c.spread = 40.f;
+        c.speedMin = 20.f;
+        c.speedMax = 60.f;
+        c.lifeMin = 0.25f;
+        c.lifeMax = 0.4f;
+        c.sizeStart = 5.f;
+        c.sizeEnd = 1.f;
+        c.colorStart = sf::Color(Colors::Player.r, Colors::Player.g, Colors::Player.b, 160);
+        c.colorEnd = sf::Color(Colors::Player.r, Colors::Player.g, Colors::Player.b, 0);
+        c.gravity = 0.f;
+        c.drag = 2.f;
+        return c;
+    }
+}
@@ -0,0 +1,176 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <iostream>
+
+// ================= LINEAR ARENA =================
+// Bump allocator: allocation is a pointer bump, reset() frees everything.
+// If a frame outgrows the buffer, extra chunks come from the heap and the
+// buffer is enlarged to the frame's peak at the next reset.
+class LinearArena
+{
+public:
+    explicit LinearArena(std::size_t capacity)
+        : m_buffer(nullptr), m_capacity(0), m_offset(0), m_overflow(nullptr),
+          m_overflowBytes(0), m_highWater(0)
+    {
+        grow(capacity);
+    }
+
+    ~LinearArena()
+    {
+        releaseOverflow();
+        ::operator delete(m_buffer);
+    }
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t))
+    {
+        std::size_t start = (m_offset + align - 1) & ~(align - 1);
+        if (start + bytes <= m_capacity)
+        {
+            m_offset = start + bytes;
+            return m_buffer + start;
+        }
+
+        // Out of space this frame: fall back to a heap chunk
+        std::size_t chunkBytes = sizeof(Overflow) + bytes + align;
+        Overflow* chunk = static_cast<Overflow*>(::operator new(chunkBytes));
+        chunk->next = m_overflow;
+        m_overflow = chunk;
+        m_overflowBytes += bytes + align;
+
+        std::uintptr_t raw = reinterpret_cast<std::uintptr_t>(chunk + 1);
+        return reinterpret_cast<void*>((raw + align - 1) & ~(std::uintptr_t)(align - 1));
+    }
+
+    // Free everything allocated since the last reset
+    void reset()
+    {
+        std::size_t used = this->used();
+        if (used > m_highWater)
+            m_highWater = used;
+
+        if (m_overflow)
+        {
+            releaseOverflow();
+            grow(used);
+        }
+        m_offset = 0;
+    }
+
+    std::size_t used() const { return m_offset + m_overflowBytes; }
+    std::size_t capacity() const { return m_capacity; }
+    std::size_t highWater() const { return m_highWater; }
+
+private:
+    struct Overflow
+    {
+        Overflow* next;
+        std::max_align_t pad;
+    };
+
+    void grow(std::size_t capacity)
+    {
+        // Round up to 4 KB
+        capacity = (capacity + 4095) & ~static_cast<std::size_t>(4095);
+        if (capacity <= m_capacity)
+            return;
+        ::operator delete(m_buffer);
+        m_buffer = static_cast<unsigned char*>(::operator new(capacity));
+        m_capacity = capacity;
+    }
+
+    void releaseOverflow()
+    {
+        while (m_overflow)
+        {
+            Overflow* next = m_overflow->next;
+            ::operator delete(m_overflow);
+            m_overflow = next;
+        }
+        m_overflowBytes = 0;
+    }
+
+    unsigned char* m_buffer;
+    std::size_t m_capacity;
+    std::size_t m_offset;
+    Overflow* m_overflow;
+    std::size_t m_overflowBytes;
+    std::size_t m_highWater;
+};
+
+// ================= FRAME ARENA =================
+// Two linear arenas used alternately. current() is wiped at the end of the
+// next frame; previous() still holds last frame's data for anything that
+// must survive one extra frame.
+class FrameArena
+{
+public:
+    static FrameArena& getInstance()
+    {
+        static FrameArena instance;
+        return instance;
+    }
+
+    LinearArena& current() { return m_arenas[m_current]; }
+    LinearArena& previous() { return m_arenas[1 - m_current]; }
+
+    void* allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t))
+    {
+        return current().allocate(bytes, align);
+    }
+
+    // Call once per frame after rendering: flips buffers and wipes the older one
+    void endFrame()
+    {
+        m_lastFrameBytes = current().used();
+        if (m_lastFrameBytes > m_peakFrameBytes)
+        {
+            m_peakFrameBytes = m_lastFrameBytes;
+#ifndef NDEBUG
+            std::cout << "[FrameArena] New per-frame high-water mark: " << m_peakFrameBytes << " bytes\n";
+#endif
+        }
+
+        m_current = 1 - m_current;
+        current().reset();
+    }
+
+    std::size_t lastFrameBytes() const { return m_lastFrameBytes; }
+    std::size_t peakFrameBytes() const { return m_peakFrameBytes; }
+
+private:
+    static constexpr std::size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    FrameArena()
+        : m_arenas{ LinearArena(DEFAULT_CAPACITY), LinearArena(DEFAULT_CAPACITY) },
+          m_current(0), m_lastFrameBytes(0), m_peakFrameBytes(0)
+    {
+    }
+
+    LinearArena m_arenas[2];
+    int m_current;
+    std::size_t m_lastFrameBytes;
+    std::size_t m_peakFrameBytes;
+};
+
+// DynamicArray storage policy backed by the current frame arena.
+// Deallocation is a no-op; memory goes away at FrameArena::endFrame().
+struct ArenaArrayAllocator
+{
+    LinearArena* arena = nullptr;
+
+    ArenaArrayAllocator() : arena(&FrameArena::getInstance().current()) {}
+    explicit ArenaArrayAllocator(LinearArena& a) : arena(&a) {}
+
+    void* allocate(std::size_t bytes, std::size_t align)
+    {
+        return arena->allocate(bytes, align);
+    }
+
+    void deallocate(void*, std::size_t, std::size_t) {}
+};
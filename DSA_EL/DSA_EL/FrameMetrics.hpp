@@ -0,0 +1,170 @@
+#pragma once
+#include "HdrHistogram.hpp"
+#include "DynamicArray.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// ================= FRAME METRICS =================
+// Soak-run telemetry. Every frame of both game loops records frame, update
+// and render time into HDR histograms keyed by (game mode, scene state).
+// When an output path is set (--metrics <file>), cumulative percentiles are
+// rewritten to that file every FLUSH_INTERVAL seconds and on exit; a .json
+// extension selects JSON, anything else CSV.
+class FrameMetrics
+{
+public:
+    static constexpr float FLUSH_INTERVAL = 10.f;   // seconds of recorded frames
+
+    static FrameMetrics& getInstance()
+    {
+        static FrameMetrics instance;
+        return instance;
+    }
+
+    void setOutput(const std::string& path)
+    {
+        m_path = path;
+        m_json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+        std::cout << "[METRICS] Writing frame-time percentiles to " << m_path << "\n";
+    }
+
+    bool hasOutput() const { return !m_path.empty(); }
+
+    // mode/state must be string literals (compared by content, stored by pointer)
+    void record(const char* mode, const char* state, float frameMs, float updateMs, float renderMs)
+    {
+        Series& s = series(mode, state);
+        s.frame.recordMs(frameMs);
+        s.update.recordMs(updateMs);
+        s.render.recordMs(renderMs);
+
+        m_sinceFlush += frameMs / 1000.f;
+        if (m_sinceFlush >= FLUSH_INTERVAL)
+        {
+            m_sinceFlush = 0.f;
+            flush();
+        }
+    }
+
+    // Rewrite the output file with the current cumulative snapshot
+    void flush()
+    {
+        if (m_path.empty())
+            return;
+
+        std::ofstream file(m_path);
+        if (!file)
+        {
+            std::cerr << "[METRICS] Failed to open " << m_path << "\n";
+            return;
+        }
+
+        if (m_json)
+            writeJson(file);
+        else
+            writeCsv(file);
+    }
+
+    void writeCsv(std::ostream& out) const
+    {
+        out << "mode,state,metric,count,mean_ms,p50_ms,p90_ms,p99_ms,p99_9_ms,max_ms\n";
+        for (int i = 0; i < m_series.size(); ++i)
+        {
+            const Series& s = *m_series[i];
+            writeCsvRow(out, s, "frame", s.frame);
+            writeCsvRow(out, s, "update", s.update);
+            writeCsvRow(out, s, "render", s.render);
+        }
+    }
+
+    void writeJson(std::ostream& out) const
+    {
+        out << "[\n";
+        for (int i = 0; i < m_series.size(); ++i)
+        {
+            const Series& s = *m_series[i];
+            out << "  { \"mode\": \"" << s.mode << "\", \"state\": \"" << s.state << "\",\n";
+            writeJsonMetric(out, "frame", s.frame, false);
+            writeJsonMetric(out, "update", s.update, false);
+            writeJsonMetric(out, "render", s.render, true);
+            out << "  }" << (i + 1 < m_series.size() ? ",\n" : "\n");
+        }
+        out << "]\n";
+    }
+
+    void reset()
+    {
+        m_series.clear();
+        m_last = nullptr;
+        m_sinceFlush = 0.f;
+    }
+
+private:
+    struct Series
+    {
+        const char* mode;
+        const char* state;
+        HdrHistogram frame;
+        HdrHistogram update;
+        HdrHistogram render;
+    };
+
+    FrameMetrics() = default;
+    FrameMetrics(const FrameMetrics&) = delete;
+    FrameMetrics& operator=(const FrameMetrics&) = delete;
+
+    Series& series(const char* mode, const char* state)
+    {
+        // Few series exist and the same one repeats, so check the last hit first
+        if (m_last && m_last->mode == mode && m_last->state == state)
+            return *m_last;
+
+        for (int i = 0; i < m_series.size(); ++i)
+        {
+            Series& s = *m_series[i];
+            if (std::strcmp(s.mode, mode) == 0 && std::strcmp(s.state, state) == 0)
+            {
+                m_last = &s;
+                return s;
+            }
+        }
+
+        std::shared_ptr<Series> s = std::make_shared<Series>();
+        s->mode = mode;
+        s->state = state;
+        m_series.push_back(s);
+        m_last = s.get();
+        return *s;
+    }
+
+    static double ms(std::uint64_t micros) { return micros / 1000.0; }
+
+    static void writeCsvRow(std::ostream& out, const Series& s, const char* metric, const HdrHistogram& h)
+    {
+        out << s.mode << "," << s.state << "," << metric << "," << h.count() << ","
+            << h.mean() / 1000.0 << ","
+            << ms(h.percentile(50.0)) << "," << ms(h.percentile(90.0)) << ","
+            << ms(h.percentile(99.0)) << "," << ms(h.percentile(99.9)) << ","
+            << ms(h.max()) << "\n";
+    }
+
+    static void writeJsonMetric(std::ostream& out, const char* metric, const HdrHistogram& h, bool last)
+    {
+        out << "    \"" << metric << "\": { \"count\": " << h.count()
+            << ", \"mean_ms\": " << h.mean() / 1000.0
+            << ", \"p50_ms\": " << ms(h.percentile(50.0))
+            << ", \"p90_ms\": " << ms(h.percentile(90.0))
+            << ", \"p99_ms\": " << ms(h.percentile(99.0))
+            << ", \"p99_9_ms\": " << ms(h.percentile(99.9))
+            << ", \"max_ms\": " << ms(h.max()) << " }" << (last ? "\n" : ",\n");
+    }
+
+    DynamicArray<std::shared_ptr<Series>> m_series;   // stable addresses for m_last
+    Series* m_last = nullptr;
+    std::string m_path;
+    bool m_json = false;
+    float m_sinceFlush = 0.f;
+};
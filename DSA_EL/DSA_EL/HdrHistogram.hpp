@@ -0,0 +1,121 @@
+#pragma once
+#include <cstdint>
+#include <algorithm>
+
+// ================= HDR HISTOGRAM =================
+// Log-linear histogram of microsecond values (1 us .. ~1 hour). Values below
+// SUB_BUCKETS are counted exactly; above that every power of two is split
+// into SUB_BUCKETS/2 linear buckets, so any recorded value is reproduced
+// within ~1.6%. Recording is a couple of shifts and one increment.
+class HdrHistogram
+{
+public:
+    static constexpr int SUB_BUCKET_BITS = 7;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;       // 128
+    static constexpr int HALF_SUB_BUCKETS = SUB_BUCKETS / 2;        // 64
+    static constexpr int MAGNITUDES = 26;                           // up to 2^32 us
+    static constexpr int BUCKET_COUNT = SUB_BUCKETS + MAGNITUDES * HALF_SUB_BUCKETS;
+
+    HdrHistogram()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill(m_counts, m_counts + BUCKET_COUNT, 0u);
+        m_total = 0;
+        m_sum = 0;
+        m_min = UINT64_MAX;
+        m_max = 0;
+    }
+
+    void record(std::uint64_t micros)
+    {
+        int index = bucketIndex(micros);
+        m_counts[index]++;
+        m_total++;
+        m_sum += micros;
+        m_min = std::min(m_min, micros);
+        m_max = std::max(m_max, micros);
+    }
+
+    void recordMs(float ms)
+    {
+        record(ms > 0.f ? static_cast<std::uint64_t>(ms * 1000.f + 0.5f) : 0);
+    }
+
+    // Value at the given percentile (0..100), in microseconds
+    std::uint64_t percentile(double p) const
+    {
+        if (m_total == 0)
+            return 0;
+
+        std::uint64_t target = static_cast<std::uint64_t>(p / 100.0 * m_total + 0.5);
+        if (target < 1) target = 1;
+        if (target > m_total) target = m_total;
+
+        std::uint64_t seen = 0;
+        for (int i = 0; i < BUCKET_COUNT; ++i)
+        {
+            seen += m_counts[i];
+            if (seen >= target)
+                return std::min(bucketMidpoint(i), m_max);
+        }
+        return m_max;
+    }
+
+    std::uint64_t count() const { return m_total; }
+    std::uint64_t max() const { return m_max; }
+    std::uint64_t min() const { return m_total ? m_min : 0; }
+    double mean() const { return m_total ? static_cast<double>(m_sum) / m_total : 0.0; }
+
+    void merge(const HdrHistogram& other)
+    {
+        for (int i = 0; i < BUCKET_COUNT; ++i)
+            m_counts[i] += other.m_counts[i];
+        m_total += other.m_total;
+        m_sum += other.m_sum;
+        m_min = std::min(m_min, other.m_min);
+        m_max = std::max(m_max, other.m_max);
+    }
+
+private:
+    static int bucketIndex(std::uint64_t v)
+    {
+        if (v < SUB_BUCKETS)
+            return static_cast<int>(v);
+
+        // Shift so the value lands in [64, 128), then index within that magnitude
+        int shift = highestBit(v) - (SUB_BUCKET_BITS - 1);
+        if (shift > MAGNITUDES)
+            return BUCKET_COUNT - 1;
+        int sub = static_cast<int>(v >> shift) - HALF_SUB_BUCKETS;
+        return SUB_BUCKETS + (shift - 1) * HALF_SUB_BUCKETS + sub;
+    }
+
+    static std::uint64_t bucketMidpoint(int index)
+    {
+        if (index < SUB_BUCKETS)
+            return static_cast<std::uint64_t>(index);
+
+        int shift = (index - SUB_BUCKETS) / HALF_SUB_BUCKETS + 1;
+        int sub = (index - SUB_BUCKETS) % HALF_SUB_BUCKETS + HALF_SUB_BUCKETS;
+        std::uint64_t low = static_cast<std::uint64_t>(sub) << shift;
+        return low + ((std::uint64_t(1) << shift) >> 1);
+    }
+
+    static int highestBit(std::uint64_t v)
+    {
+        int bit = 0;
+        while (v >>= 1)
+            bit++;
+        return bit;
+    }
+
+    std::uint32_t m_counts[BUCKET_COUNT];
+    std::uint64_t m_total;
+    std::uint64_t m_sum;
+    std::uint64_t m_min;
+    std::uint64_t m_max;
+};
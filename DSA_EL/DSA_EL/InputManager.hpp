@@ -27,6 +27,13 @@ struct InputEvent
     InputEvent(InputAction a, float t) : action(a), timestamp(t) {}
 };
 
+// Per-tick input snapshot handed to the game worlds (keyboard or scripted)
+struct PlayerInput
+{
+    sf::Vector2f move;      // Direction, each axis in [-1, 1]
+    bool jump = false;      // Jump tapped this tick
+};
+
 // Centralized input manager using Queue data structure
 class InputManager
 {
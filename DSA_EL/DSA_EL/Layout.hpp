@@ -0,0 +1,90 @@
+#pragma once
+#include "SceneNode.hpp"
+#include <algorithm>
+
+// ================= STACK LAYOUT =================
+// Container that lines its visible children up along one axis. Each child
+// keeps its measured size plus margins and is aligned on the cross axis.
+// Like every SceneNode, it measures and arranges only when a child's
+// content or visibility, or the stack's own settings, have changed.
+enum class Orientation { Vertical, Horizontal };
+enum class Align { Start, Center, End };
+
+class StackLayout : public SceneNode {
+public:
+    explicit StackLayout(Orientation orientation, float spacing = 0.f, Align align = Align::Center,
+                         const Insets& padding = {})
+        : m_orientation(orientation), m_spacing(spacing), m_align(align), m_padding(padding) {}
+
+    void setSpacing(float spacing) { m_spacing = spacing; markLayoutDirty(); }
+    void setAlign(Align align) { m_align = align; markLayoutDirty(); }
+    void setPadding(const Insets& padding) { m_padding = padding; markLayoutDirty(); }
+
+protected:
+    sf::Vector2f measure() override {
+        bool vertical = m_orientation == Orientation::Vertical;
+        float along = 0.f;
+        float across = 0.f;
+        int count = 0;
+
+        for (SceneNode* child : children) {
+            if (!child->isVisible())
+                continue;
+            const sf::Vector2f& size = child->getDesiredSize();
+            const Insets& margin = child->getMargin();
+            if (vertical) {
+                along += size.y + margin.vertical();
+                across = std::max(across, size.x + margin.horizontal());
+            } else {
+                along += size.x + margin.horizontal();
+                across = std::max(across, size.y + margin.vertical());
+            }
+            ++count;
+        }
+        if (count > 1)
+            along += m_spacing * (count - 1);
+
+        return vertical ? sf::Vector2f(across + m_padding.horizontal(), along + m_padding.vertical())
+                        : sf::Vector2f(along + m_padding.horizontal(), across + m_padding.vertical());
+    }
+
+    void arrangeChildren(sf::Vector2f size) override {
+        bool vertical = m_orientation == Orientation::Vertical;
+        float cursor = vertical ? m_padding.top : m_padding.left;
+        float crossStart = vertical ? m_padding.left : m_padding.top;
+        float crossSpace = vertical ? size.x - m_padding.horizontal() : size.y - m_padding.vertical();
+
+        for (SceneNode* child : children) {
+            if (!child->isVisible())
+                continue;
+            const sf::Vector2f& childSize = child->getDesiredSize();
+            const Insets& margin = child->getMargin();
+
+            if (vertical) {
+                cursor += margin.top;
+                float x = alignOffset(crossStart, crossSpace, childSize.x, margin.left, margin.right);
+                child->arrange({ { x, cursor }, childSize });
+                cursor += childSize.y + margin.bottom + m_spacing;
+            } else {
+                cursor += margin.left;
+                float y = alignOffset(crossStart, crossSpace, childSize.y, margin.top, margin.bottom);
+                child->arrange({ { cursor, y }, childSize });
+                cursor += childSize.x + margin.right + m_spacing;
+            }
+        }
+    }
+
+private:
+    float alignOffset(float start, float space, float size, float before, float after) const {
+        switch (m_align) {
+        case Align::Start:  return start + before;
+        case Align::End:    return start + space - size - after;
+        default:            return start + (space - size + before - after) / 2.f;
+        }
+    }
+
+    Orientation m_orientation;
+    float m_spacing;
+    Align m_align;
+    Insets m_padding;
+};
@@ -1,4 +1,7 @@
 #pragma once
+#include "PoolAllocator.hpp"
+#include <new>
+#include <utility>
 
 template<typename T>
 struct Node {
@@ -6,26 +9,77 @@ struct Node {
     Node* next;
 };
 
-template<typename T>
+// Singly linked list. Nodes come from an allocator (a shared slab pool by
+// default), so push_front is O(1) without a malloc per element.
+template<typename T, typename Allocator = PoolAllocator<Node<T>>>
 class LinkedList {
 public:
-    LinkedList() : head(nullptr) {}
+    LinkedList() : head(nullptr), m_size(0), m_alloc(&Allocator::shared()) {}
+    explicit LinkedList(Allocator& alloc) : head(nullptr), m_size(0), m_alloc(&alloc) {}
+
+    ~LinkedList() { clear(); }
+
+    LinkedList(const LinkedList&) = delete;
+    LinkedList& operator=(const LinkedList&) = delete;
+
+    // Moves steal the nodes together with the allocator that owns them
+    LinkedList(LinkedList&& other) noexcept
+        : head(other.head), m_size(other.m_size), m_alloc(other.m_alloc) {
+        other.head = nullptr;
+        other.m_size = 0;
+    }
+
+    LinkedList& operator=(LinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head;
+            m_size = other.m_size;
+            m_alloc = other.m_alloc;
+            other.head = nullptr;
+            other.m_size = 0;
+        }
+        return *this;
+    }
 
     void push_front(const T& value) {
-        Node<T>* n = new Node<T>{ value, head };
+        Node<T>* n = new (m_alloc->allocate()) Node<T>{ value, head };
         head = n;
+        m_size++;
+    }
+
+    bool pop_front(T& out) {
+        if (!head)
+            return false;
+
+        Node<T>* temp = head;
+        out = std::move(temp->data);
+        head = head->next;
+        destroyNode(temp);
+        m_size--;
+        return true;
     }
 
     void clear() {
         while (head) {
             Node<T>* temp = head;
             head = head->next;
-            delete temp;
+            destroyNode(temp);
         }
+        m_size = 0;
     }
 
+    int size() const { return m_size; }
+    bool empty() const { return head == nullptr; }
+
     Node<T>* getHead() const { return head; }
 
 private:
+    void destroyNode(Node<T>* n) {
+        n->~Node<T>();
+        m_alloc->deallocate(n);
+    }
+
     Node<T>* head;
+    int m_size;
+    Allocator* m_alloc;
 };
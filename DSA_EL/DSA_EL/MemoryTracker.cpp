@@ -0,0 +1,293 @@
+#include "MemoryTracker.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+namespace
+{
+    thread_local MemTag t_currentTag = MemTag::General;
+
+    const char* const TAG_NAMES[static_cast<int>(MemTag::Count)] = {
+        "general", "world", "particles", "collision", "ui", "resources"
+    };
+
+#ifdef DSA_TRACK_MEMORY
+    // ---------------- Counters ----------------
+    // Plain static atomics (no constructors) so they are usable from the very
+    // first allocation, before any other static initialisation has run.
+    struct TagCounters
+    {
+        std::atomic<long long> liveBytes;
+        std::atomic<long long> liveAllocs;
+        std::atomic<long long> totalAllocs;
+        std::atomic<long long> totalBytes;
+        std::atomic<long long> peakBytes;
+    };
+
+    TagCounters s_tags[static_cast<int>(MemTag::Count)];
+
+    std::atomic<long long> s_frameAllocs;
+    std::atomic<long long> s_frameBytes;
+    long long s_lastFrameAllocs = 0;
+    long long s_lastFrameBytes = 0;
+    long long s_peakFrameAllocs = 0;
+    long long s_peakFrameBytes = 0;
+
+    std::atomic<bool> s_exitHookInstalled;
+    char s_exitJsonPath[512] = "";     // Empty: no JSON dump at exit
+
+    // ---------------- Block header ----------------
+    // Stored just before every tracked block so delete knows its size and tag
+    constexpr std::size_t HEADER_SIZE = 16;
+    constexpr std::uint16_t HEADER_MAGIC = 0xD5A1;
+
+    struct Header
+    {
+        void* base;             // what malloc returned
+        std::uint32_t size;
+        std::uint16_t tag;
+        std::uint16_t magic;
+    };
+    static_assert(sizeof(Header) <= HEADER_SIZE, "header must fit in front of the block");
+
+    void reportAtExit();
+
+    void updatePeak(std::atomic<long long>& peak, long long value)
+    {
+        long long current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    void* trackedAlloc(std::size_t size, std::size_t align)
+    {
+        if (!s_exitHookInstalled.exchange(true))
+            std::atexit(reportAtExit);
+
+        std::size_t padding = align;   // only over-aligned new passes a non-zero alignment
+        void* base = std::malloc(size + HEADER_SIZE + padding);
+        if (!base)
+            return nullptr;
+
+        std::uintptr_t user = reinterpret_cast<std::uintptr_t>(base) + HEADER_SIZE;
+        if (padding)
+            user = (user + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+
+        MemTag tag = t_currentTag;
+        Header* header = reinterpret_cast<Header*>(user - HEADER_SIZE);
+        header->base = base;
+        header->size = static_cast<std::uint32_t>(size);
+        header->tag = static_cast<std::uint16_t>(tag);
+        header->magic = HEADER_MAGIC;
+
+        TagCounters& c = s_tags[static_cast<int>(tag)];
+        long long live = c.liveBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed) + static_cast<long long>(size);
+        c.liveAllocs.fetch_add(1, std::memory_order_relaxed);
+        c.totalAllocs.fetch_add(1, std::memory_order_relaxed);
+        c.totalBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+        updatePeak(c.peakBytes, live);
+
+        s_frameAllocs.fetch_add(1, std::memory_order_relaxed);
+        s_frameBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+
+        return reinterpret_cast<void*>(user);
+    }
+
+    void trackedFree(void* ptr)
+    {
+        if (!ptr)
+            return;
+
+        Header* header = reinterpret_cast<Header*>(static_cast<unsigned char*>(ptr) - HEADER_SIZE);
+        if (header->magic != HEADER_MAGIC)
+        {
+            std::fprintf(stderr, "[MemoryTracker] delete of untracked or corrupted block %p\n", ptr);
+            std::abort();
+        }
+
+        TagCounters& c = s_tags[header->tag];
+        c.liveBytes.fetch_sub(static_cast<long long>(header->size), std::memory_order_relaxed);
+        c.liveAllocs.fetch_sub(1, std::memory_order_relaxed);
+
+        header->magic = 0;
+        std::free(header->base);
+    }
+
+    void* allocOrThrow(std::size_t size, std::size_t align)
+    {
+        void* p = trackedAlloc(size ? size : 1, align);
+        if (!p)
+            throw std::bad_alloc();
+        return p;
+    }
+
+    // Anything still live at exit is reported per tag; the full stats are
+    // dumped only when a path was set (--memory-json)
+    void reportAtExit()
+    {
+        bool clean = true;
+        for (int i = 0; i < static_cast<int>(MemTag::Count); ++i)
+        {
+            long long allocs = s_tags[i].liveAllocs.load();
+            if (allocs > 0)
+            {
+                clean = false;
+                std::printf("[MemoryTracker] LEAK? %s: %lld allocations, %lld bytes still live at exit\n",
+                    TAG_NAMES[i], allocs, s_tags[i].liveBytes.load());
+            }
+        }
+        if (clean)
+            std::printf("[MemoryTracker] No live allocations at exit\n");
+
+        if (s_exitJsonPath[0] && MemoryTracker::dumpJson(s_exitJsonPath))
+            std::printf("[MemoryTracker] Stats written to %s\n", s_exitJsonPath);
+    }
+#endif
+}
+
+// ---------------- Queries ----------------
+bool MemoryTracker::isEnabled()
+{
+#ifdef DSA_TRACK_MEMORY
+    return true;
+#else
+    return false;
+#endif
+}
+
+MemoryStats MemoryTracker::getStats(MemTag tag)
+{
+    MemoryStats stats;
+#ifdef DSA_TRACK_MEMORY
+    const TagCounters& c = s_tags[static_cast<int>(tag)];
+    stats.liveBytes = c.liveBytes.load(std::memory_order_relaxed);
+    stats.liveAllocs = c.liveAllocs.load(std::memory_order_relaxed);
+    stats.totalAllocs = c.totalAllocs.load(std::memory_order_relaxed);
+    stats.totalBytes = c.totalBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = c.peakBytes.load(std::memory_order_relaxed);
+#else
+    (void)tag;
+#endif
+    return stats;
+}
+
+MemoryStats MemoryTracker::getTotal()
+{
+    MemoryStats total;
+    for (int i = 0; i < static_cast<int>(MemTag::Count); ++i)
+    {
+        MemoryStats s = getStats(static_cast<MemTag>(i));
+        total.liveBytes += s.liveBytes;
+        total.liveAllocs += s.liveAllocs;
+        total.totalAllocs += s.totalAllocs;
+        total.totalBytes += s.totalBytes;
+        total.peakBytes += s.peakBytes;     // sum of per-tag peaks (upper bound)
+    }
+    return total;
+}
+
+FrameMemoryStats MemoryTracker::getFrameStats()
+{
+    FrameMemoryStats stats;
+#ifdef DSA_TRACK_MEMORY
+    stats.allocs = s_lastFrameAllocs;
+    stats.bytes = s_lastFrameBytes;
+    stats.peakAllocs = s_peakFrameAllocs;
+    stats.peakBytes = s_peakFrameBytes;
+#endif
+    return stats;
+}
+
+void MemoryTracker::endFrame()
+{
+#ifdef DSA_TRACK_MEMORY
+    s_lastFrameAllocs = s_frameAllocs.exchange(0, std::memory_order_relaxed);
+    s_lastFrameBytes = s_frameBytes.exchange(0, std::memory_order_relaxed);
+    if (s_lastFrameAllocs > s_peakFrameAllocs)
+        s_peakFrameAllocs = s_lastFrameAllocs;
+    if (s_lastFrameBytes > s_peakFrameBytes)
+        s_peakFrameBytes = s_lastFrameBytes;
+#endif
+}
+
+// ---------------- JSON ----------------
+void MemoryTracker::writeJson(std::ostream& out)
+{
+    FrameMemoryStats frame = getFrameStats();
+
+    out << "{\n";
+    out << "  \"enabled\": " << (isEnabled() ? "true" : "false") << ",\n";
+    out << "  \"frame\": { \"allocs\": " << frame.allocs << ", \"bytes\": " << frame.bytes
+        << ", \"peakAllocs\": " << frame.peakAllocs << ", \"peakBytes\": " << frame.peakBytes << " },\n";
+    out << "  \"tags\": {\n";
+    for (int i = 0; i < static_cast<int>(MemTag::Count); ++i)
+    {
+        MemoryStats s = getStats(static_cast<MemTag>(i));
+        out << "    \"" << TAG_NAMES[i] << "\": { \"liveBytes\": " << s.liveBytes
+            << ", \"liveAllocs\": " << s.liveAllocs
+            << ", \"totalAllocs\": " << s.totalAllocs
+            << ", \"totalBytes\": " << s.totalBytes
+            << ", \"peakBytes\": " << s.peakBytes << " }"
+            << (i + 1 < static_cast<int>(MemTag::Count) ? ",\n" : "\n");
+    }
+    out << "  }\n";
+    out << "}\n";
+}
+
+bool MemoryTracker::dumpJson(const char* path)
+{
+    std::ofstream file(path);
+    if (!file)
+        return false;
+    writeJson(file);
+    return true;
+}
+
+void MemoryTracker::setExitJson(const char* path)
+{
+#ifdef DSA_TRACK_MEMORY
+    std::snprintf(s_exitJsonPath, sizeof(s_exitJsonPath), "%s", path ? path : "");
+#else
+    (void)path;
+    std::fprintf(stderr, "[MemoryTracker] Built without DSA_TRACK_MEMORY: no stats to write\n");
+#endif
+}
+
+const char* MemoryTracker::tagName(MemTag tag)
+{
+    return TAG_NAMES[static_cast<int>(tag)];
+}
+
+MemTag MemoryTracker::currentTag()
+{
+    return t_currentTag;
+}
+
+void MemoryTracker::setCurrentTag(MemTag tag)
+{
+    t_currentTag = tag;
+}
+
+// ================= GLOBAL NEW / DELETE =================
+#ifdef DSA_TRACK_MEMORY
+void* operator new(std::size_t size) { return allocOrThrow(size, 0); }
+void* operator new[](std::size_t size) { return allocOrThrow(size, 0); }
+void* operator new(std::size_t size, std::align_val_t align) { return allocOrThrow(size, static_cast<std::size_t>(align)); }
+void* operator new[](std::size_t size, std::align_val_t align) { return allocOrThrow(size, static_cast<std::size_t>(align)); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size ? size : 1, 0); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size ? size : 1, 0); }
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+#endif
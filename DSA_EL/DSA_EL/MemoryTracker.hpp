@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <ostream>
+
+// ================= MEMORY TRACKER =================
+// Opt-in heap accounting. Build with DSA_TRACK_MEMORY defined and global
+// operator new/delete are replaced (MemoryTracker.cpp) so every allocation
+// is charged to the calling thread's current tag. Without the define the
+// scopes still compile but all statistics stay at zero.
+
+enum class MemTag
+{
+    General,
+    World,      // ECS registry, obstacle/orb streams
+    Particles,
+    Collision,
+    UI,
+    Resources,
+    Count
+};
+
+struct MemoryStats
+{
+    long long liveBytes = 0;
+    long long liveAllocs = 0;
+    long long totalAllocs = 0;
+    long long totalBytes = 0;
+    long long peakBytes = 0;    // high-water mark of liveBytes
+};
+
+struct FrameMemoryStats
+{
+    long long allocs = 0;       // allocations made during the last frame
+    long long bytes = 0;
+    long long peakAllocs = 0;   // worst frame so far
+    long long peakBytes = 0;
+};
+
+class MemoryTracker
+{
+public:
+    static bool isEnabled();
+
+    static MemoryStats getStats(MemTag tag);
+    static MemoryStats getTotal();
+    static FrameMemoryStats getFrameStats();
+
+    // Close the current frame's allocation counters
+    static void endFrame();
+
+    static void writeJson(std::ostream& out);
+    static bool dumpJson(const char* path);
+
+    // Also dump the stats to `path` at exit, after the leak report
+    static void setExitJson(const char* path);
+
+    static const char* tagName(MemTag tag);
+
+    static MemTag currentTag();
+    static void setCurrentTag(MemTag tag);
+};
+
+// Charges allocations in the enclosing block to a tag; restores the previous tag on exit
+class MemoryScope
+{
+public:
+    explicit MemoryScope(MemTag tag) : m_previous(MemoryTracker::currentTag())
+    {
+        MemoryTracker::setCurrentTag(tag);
+    }
+
+    ~MemoryScope()
+    {
+        MemoryTracker::setCurrentTag(m_previous);
+    }
+
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+
+private:
+    MemTag m_previous;
+};
@@ -0,0 +1,100 @@
+#include "MenuScene.hpp"
+#include "SurvivalScene.hpp"
+#include "DashScene.hpp"
+
+// ---------------- Constructor ----------------
+MenuScene::MenuScene(SceneStack& stack)
+    : Scene(stack), m_font(stack.font()),
+      m_column(Orientation::Vertical, 25.f),
+      m_title("GAME ENGINE", m_font, 52),
+      m_subtitle("Select a game", m_font, 20),
+      m_footer("DSA Project - SFML 3.0", m_font, 14),
+      m_cache(sf::Vector2u(stack.window().getVirtualSize()))
+{
+    m_survivalButton = std::make_unique<Button>(sf::Vector2f(280.f, 65.f), "SURVIVAL", m_font);
+    m_dashButton = std::make_unique<Button>(sf::Vector2f(280.f, 65.f), "DASH", m_font);
+    m_exitButton = std::make_unique<Button>(sf::Vector2f(180.f, 50.f), "EXIT", m_font);
+
+    // Buttons fire on release, so the click never leaks into the pushed scene
+    m_survivalButton->setCallback([this]() { m_stack.push(std::make_unique<SurvivalScene>(m_stack)); });
+    m_dashButton->setCallback([this]() { m_stack.push(std::make_unique<DashScene>(m_stack)); });
+    m_exitButton->setCallback([this]() { m_stack.clear(); });
+
+    // Layout: positions come from the stack, not from pixel offsets
+    m_title.setColor(Colors::Accent);
+    m_subtitle.setColor(Colors::TextDim);
+    m_footer.setColor(sf::Color(80, 80, 100));
+    m_survivalButton->setMargin({ 0.f, 45.f, 0.f, 0.f });
+    m_exitButton->setMargin({ 0.f, 20.f, 0.f, 0.f });
+
+    m_column.addChild(&m_title);
+    m_column.addChild(&m_subtitle);
+    m_column.addChild(m_survivalButton.get());
+    m_column.addChild(m_dashButton.get());
+    m_column.addChild(m_exitButton.get());
+    m_column.setAnchor(Anchor::Top);
+    m_column.setMargin({ 0.f, 70.f, 0.f, 0.f });
+
+    m_footer.setAnchor(Anchor::Bottom);
+    m_footer.setMargin({ 0.f, 0.f, 0.f, 25.f });
+
+    m_ui.addChild(&m_column);
+    m_ui.addChild(&m_footer);
+
+    // Background grid (cached), covering the virtual screen
+    sf::Vector2f screen = stack.window().getVirtualSize();
+    m_grid.setPrimitiveType(sf::PrimitiveType::Lines);
+    sf::Color lineColor(40, 40, 60, 100);
+    for (float x = 0; x < screen.x; x += 50.f)
+    {
+        m_grid.append(sf::Vertex{ { x, 0.f }, lineColor });
+        m_grid.append(sf::Vertex{ { x, screen.y }, lineColor });
+    }
+    for (float y = 0; y < screen.y; y += 50.f)
+    {
+        m_grid.append(sf::Vertex{ { 0.f, y }, lineColor });
+        m_grid.append(sf::Vertex{ { screen.x, y }, lineColor });
+    }
+}
+
+void MenuScene::enter()
+{
+    m_stack.window().setTitle("DSA Game Engine");
+}
+
+// The game takes over the mouse; forget hover/press so nothing is stuck highlighted
+void MenuScene::suspend()
+{
+    m_ui.reset();
+    m_cache.invalidate();
+}
+
+void MenuScene::resume()
+{
+    m_stack.window().setTitle("DSA Game Engine");
+}
+
+void MenuScene::handleEvent(const sf::Event& event)
+{
+    if (m_ui.handleEvent(event, m_stack.window().native(), m_stack.window().view()))
+        m_cache.invalidate();
+
+    if (auto* keyEvent = event.getIf<sf::Event::KeyPressed>())
+    {
+        if (keyEvent->code == sf::Keyboard::Key::Escape)
+            m_stack.clear();
+    }
+}
+
+void MenuScene::render(sf::RenderTarget& target)
+{
+    target.setView(m_stack.screenView());
+    if (m_ui.layout(m_stack.screenView().getSize()))
+        m_cache.invalidate();
+
+    m_cache.draw(target, [this](sf::RenderTarget& layer) {
+        layer.clear(Colors::Background);
+        layer.draw(m_grid);
+        m_ui.draw(layer);
+    });
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "Scene.hpp"
+#include "UI.hpp"
+#include "UICache.hpp"
+
+// ================= MAIN MENU =================
+// Bottom of the scene stack: picks a game mode or quits.
+class MenuScene : public Scene
+{
+public:
+    explicit MenuScene(SceneStack& stack);
+
+    void enter() override;
+    void suspend() override;
+    void resume() override;
+    void handleEvent(const sf::Event& event) override;
+    void update(float) override {}      // Input-driven: nothing to step
+    void render(sf::RenderTarget& target) override;
+
+    bool isAnimating() const override { return false; }
+    const char* mode() const override { return "menu"; }
+    const char* name() const override { return "Menu"; }
+
+private:
+    sf::Font* m_font;
+    UIRoot m_ui;
+    StackLayout m_column;           // Title, subtitle and buttons, centred under the top edge
+    Label m_title;
+    Label m_subtitle;
+    Label m_footer;
+    std::unique_ptr<Button> m_survivalButton;
+    std::unique_ptr<Button> m_dashButton;
+    std::unique_ptr<Button> m_exitButton;
+    sf::VertexArray m_grid;
+    UICache m_cache;                // Whole screen; redrawn on hover/press changes only
+};
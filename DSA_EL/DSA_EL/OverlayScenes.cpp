@@ -0,0 +1,157 @@
+#include "OverlayScenes.hpp"
+
+// ================= PAUSE OVERLAY =================
+
+PauseScene::PauseScene(SceneStack& stack)
+    : Scene(stack), m_font(stack.font()),
+      m_panel({ 300.f, 280.f }),
+      m_column(Orientation::Vertical, 15.f),
+      m_title("PAUSED", m_font, 40),
+      m_hint("Press ESC to Resume", m_font, 18),
+      m_cache(sf::Vector2u(stack.window().getVirtualSize()))
+{
+    m_resumeButton = std::make_unique<Button>(sf::Vector2f(220.f, 55.f), "RESUME", m_font);
+    m_menuButton = std::make_unique<Button>(sf::Vector2f(220.f, 55.f), "MENU", m_font);
+
+    m_resumeButton->setCallback([this]() { resumeGame(); });
+    m_menuButton->setCallback([this]() { backToMenu(); });
+
+    m_panel.setOutline(2.f, Colors::Accent);
+    m_panel.setAnchor(Anchor::Center);
+    m_title.setColor(Colors::Accent);
+    m_hint.setColor(Colors::TextDim);
+    m_resumeButton->setMargin({ 0.f, 10.f, 0.f, 0.f });
+    m_hint.setMargin({ 0.f, 10.f, 0.f, 0.f });
+
+    m_column.addChild(&m_title);
+    m_column.addChild(m_resumeButton.get());
+    m_column.addChild(m_menuButton.get());
+    m_column.addChild(&m_hint);
+    m_column.setAnchor(Anchor::Center);
+
+    m_panel.addChild(&m_column);
+    m_ui.addChild(&m_panel);
+}
+
+void PauseScene::handleEvent(const sf::Event& event)
+{
+    if (m_ui.handleEvent(event, m_stack.window().native(), m_stack.window().view()))
+        m_cache.invalidate();
+
+    if (auto* keyEvent = event.getIf<sf::Event::KeyPressed>())
+    {
+        if (keyEvent->code == sf::Keyboard::Key::Escape)
+            resumeGame();
+    }
+}
+
+void PauseScene::render(sf::RenderTarget& target)
+{
+    target.setView(m_stack.screenView());
+    if (m_ui.layout(m_stack.screenView().getSize()))
+        m_cache.invalidate();
+
+    m_cache.draw(target, [this](sf::RenderTarget& layer) {
+        sf::RectangleShape overlay(layer.getView().getSize());
+        overlay.setFillColor(Colors::Overlay);
+        layer.draw(overlay);
+
+        m_ui.draw(layer);
+    });
+}
+
+void PauseScene::resumeGame()
+{
+    if (m_closing)
+        return;
+    m_closing = true;
+    m_stack.pop();
+}
+
+// Pops this overlay and the game under it
+void PauseScene::backToMenu()
+{
+    if (m_closing)
+        return;
+    m_closing = true;
+    m_stack.pop();
+    m_stack.pop();
+}
+
+// ================= GAME OVER OVERLAY =================
+
+GameOverScene::GameOverScene(SceneStack& stack, DynamicArray<OverlayText> lines, std::function<void()> onRetry, bool retryOnSpace)
+    : Scene(stack), m_font(stack.font()),
+      m_onRetry(std::move(onRetry)), m_retryOnSpace(retryOnSpace),
+      m_column(Orientation::Vertical, 15.f), m_cache(sf::Vector2u(stack.window().getVirtualSize()))
+{
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        const OverlayText& line = lines[i];
+        m_lines.push_back(std::make_unique<Label>(line.text, m_font, line.size));
+        m_lines.back()->setColor(line.color);
+        m_column.addChild(m_lines.back().get());
+    }
+
+    m_retryButton = std::make_unique<Button>(sf::Vector2f(220.f, 55.f), "RETRY", m_font);
+    m_menuButton = std::make_unique<Button>(sf::Vector2f(220.f, 55.f), "MENU", m_font);
+
+    m_retryButton->setCallback([this]() { retry(); });
+    m_menuButton->setCallback([this]() { backToMenu(); });
+
+    m_retryButton->setMargin({ 0.f, 30.f, 0.f, 0.f });
+    m_column.addChild(m_retryButton.get());
+    m_column.addChild(m_menuButton.get());
+    m_column.setAnchor(Anchor::Center);
+
+    m_ui.addChild(&m_column);
+}
+
+void GameOverScene::handleEvent(const sf::Event& event)
+{
+    if (m_ui.handleEvent(event, m_stack.window().native(), m_stack.window().view()))
+        m_cache.invalidate();
+
+    if (auto* keyEvent = event.getIf<sf::Event::KeyPressed>())
+    {
+        if (keyEvent->code == sf::Keyboard::Key::Escape)
+            backToMenu();
+        else if (keyEvent->code == sf::Keyboard::Key::Space && m_retryOnSpace)
+            retry();
+    }
+}
+
+void GameOverScene::render(sf::RenderTarget& target)
+{
+    target.setView(m_stack.screenView());
+    if (m_ui.layout(m_stack.screenView().getSize()))
+        m_cache.invalidate();
+
+    m_cache.draw(target, [this](sf::RenderTarget& layer) {
+        sf::RectangleShape overlay(layer.getView().getSize());
+        overlay.setFillColor(Colors::Overlay);
+        layer.draw(overlay);
+
+        m_ui.draw(layer);
+    });
+}
+
+// Restarts the round underneath and drops back to it
+void GameOverScene::retry()
+{
+    if (m_closing)
+        return;
+    m_closing = true;
+    if (m_onRetry)
+        m_onRetry();
+    m_stack.pop();
+}
+
+void GameOverScene::backToMenu()
+{
+    if (m_closing)
+        return;
+    m_closing = true;
+    m_stack.pop();
+    m_stack.pop();
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "Scene.hpp"
+#include "UI.hpp"
+#include "UICache.hpp"
+#include "DynamicArray.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ================= PAUSE OVERLAY =================
+// Freezes the scene underneath (no updates) but keeps drawing it behind a panel.
+class PauseScene : public Scene
+{
+public:
+    explicit PauseScene(SceneStack& stack);
+
+    void handleEvent(const sf::Event& event) override;
+    void update(float) override {}      // Input-driven: nothing to step
+    void render(sf::RenderTarget& target) override;
+
+    bool rendersBelow() const override { return true; }
+    bool isAnimating() const override { return false; }
+    const char* name() const override { return "Paused"; }
+
+private:
+    void resumeGame();
+    void backToMenu();
+
+    sf::Font* m_font;
+    bool m_closing = false;     // Pops already queued this frame
+    UIRoot m_ui;
+    Panel m_panel;                  // Centred in the view
+    StackLayout m_column;           // Centred in the panel
+    Label m_title;
+    Label m_hint;
+    std::unique_ptr<Button> m_resumeButton;
+    std::unique_ptr<Button> m_menuButton;
+    UICache m_cache;                // Dim, panel, text and buttons in one sprite
+};
+
+// ================= GAME OVER OVERLAY =================
+// Result screen over a finished round. The round below keeps updating so
+// its particles play out; the game scene itself stops simulating. The
+// result lines and buttons form one column centred in the view.
+struct OverlayText
+{
+    std::string text;
+    unsigned int size = 20;
+    sf::Color color = Colors::Text;
+};
+
+class GameOverScene : public Scene
+{
+public:
+    GameOverScene(SceneStack& stack, DynamicArray<OverlayText> lines, std::function<void()> onRetry, bool retryOnSpace);
+
+    void handleEvent(const sf::Event& event) override;
+    void update(float) override {}      // Input-driven: nothing to step
+    void render(sf::RenderTarget& target) override;
+
+    bool updatesBelow() const override { return true; }
+    bool rendersBelow() const override { return true; }
+    bool isAnimating() const override { return false; }
+    const char* name() const override { return "GameOver"; }
+
+private:
+    void retry();
+    void backToMenu();
+
+    sf::Font* m_font;
+    bool m_closing = false;
+    std::function<void()> m_onRetry;
+    bool m_retryOnSpace;
+    UIRoot m_ui;
+    StackLayout m_column;
+    std::vector<std::unique_ptr<Label>> m_lines;
+    std::unique_ptr<Button> m_retryButton;
+    std::unique_ptr<Button> m_menuButton;
+    UICache m_cache;
+};
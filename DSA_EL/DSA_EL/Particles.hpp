@@ -1,108 +1,431 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "DynamicArray.hpp"
+#include "MemoryTracker.hpp"
+#include "Profiler.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cassert>
 #include <cstdlib>
 #include <cstdint>
 #include <cmath>
 
-// Simple particle for visual effects
-struct Particle
+// ================= EMITTER CONFIG =================
+// Data for one effect. A burst spawns `burst` particles at once; a positive
+// rate spawns continuously (particles per second) from a running emitter.
+// Launch velocity is a random speed inside a cone, plus a fixed offset.
+// Size and colour are curves from the start to the end value over each
+// particle's lifetime.
+struct EmitterConfig
 {
-    sf::CircleShape shape;
-    sf::Vector2f velocity;
-    float lifetime;
-    float maxLifetime;
-    sf::Color startColor;
-    sf::Color endColor;
+    int burst = 0;
+    float rate = 0.f;
 
-    Particle() : velocity(0.f, 0.f), lifetime(0.f), maxLifetime(1.f), 
-        startColor(sf::Color::White), endColor(sf::Color::Transparent)
+    float direction = 0.f;                  // Cone centre, degrees (0 = +x, 90 = down)
+    float spread = 360.f;                   // Cone width, degrees
+    float speedMin = 50.f;
+    float speedMax = 200.f;
+    sf::Vector2f velocityOffset;
+
+    float lifeMin = 0.5f;
+    float lifeMax = 1.f;
+
+    float sizeStart = 6.f;                  // Square side, world units
+    float sizeEnd = 6.f;
+    sf::Color colorStart = sf::Color::White;
+    sf::Color colorEnd = sf::Color::Transparent;
+
+    float gravity = 200.f;
+    float drag = 0.f;                       // Share of velocity lost per second
+};
+
+// Render snapshot of a particle system: two triangles per particle, drawn
+// in one call. Filled on the simulation thread, drawn on the render thread.
+class ParticleBatch
+{
+public:
+    void draw(sf::RenderTarget& target) const
     {
-        shape.setRadius(3.f);
-        shape.setPosition({0.f, 0.f});
-        shape.setFillColor(sf::Color::White);
+        if (m_vertices.size() == 0)
+            return;
+        target.draw(m_vertices.data(), static_cast<std::size_t>(m_vertices.size()), sf::PrimitiveType::Triangles);
+        Profiler::getInstance().count(PerfCounter::DrawCalls, 1);
     }
 
-    Particle(sf::Vector2f pos, sf::Vector2f vel, float life, sf::Color start, sf::Color end)
-        : velocity(vel), lifetime(life), maxLifetime(life), startColor(start), endColor(end)
+    // Room for `particles` quads, so filling never allocates mid-frame
+    void reserve(int particles)
     {
-        shape.setRadius(3.f);
-        shape.setPosition(pos);
-        shape.setFillColor(start);
+        MemoryScope scope(MemTag::Particles);
+        m_vertices.reserve(particles * 6);
     }
 
-    bool update(float dt)
-    {
-        lifetime -= dt;
-        if (lifetime <= 0.f)
-            return false;
+    int size() const { return m_vertices.size() / 6; }
 
-        shape.move(velocity * dt);
-        velocity.y += 200.f * dt; // gravity
+private:
+    friend class ParticleSystem;
+    DynamicArray<sf::Vertex, CacheLineAllocator> m_vertices;
+};
 
-        // Fade color
-        float t = 1.f - (lifetime / maxLifetime);
-        std::uint8_t r = static_cast<std::uint8_t>(startColor.r + t * (endColor.r - startColor.r));
-        std::uint8_t g = static_cast<std::uint8_t>(startColor.g + t * (endColor.g - startColor.g));
-        std::uint8_t b = static_cast<std::uint8_t>(startColor.b + t * (endColor.b - startColor.b));
-        std::uint8_t a = static_cast<std::uint8_t>(255 * (1.f - t));
-        shape.setFillColor(sf::Color(r, g, b, a));
+// ================= PARTICLE SYSTEM =================
+// Fixed-capacity pool: every array is allocated once, in the constructor,
+// and spawns beyond the capacity are dropped (and counted), so effects
+// never allocate mid-frame or exceed their budget. Emitter configs are
+// registered up front (at scene load) and referenced by id.
+//
+// Structure of arrays: each field is its own cache-line-aligned array, cut
+// into CHUNK_SIZE ranges that the thread pool processes in parallel. Chunk
+// boundaries fall on cache lines, so threads only meet on the one line
+// where two chunks' compacted outputs join. update() runs two parallel
+// passes with a serial prefix sum between them:
+//   1. count each chunk's survivors
+//   2. offsets = exclusive prefix sum of the counts
+//   3. step each chunk's survivors and write them, packed, into the spare
+//      arrays at the chunk's offset; then swap the array sets
+// Order is preserved, so the result matches a serial in-place compaction.
+// Systems smaller than one chunk never leave the calling thread.
+class ParticleSystem
+{
+public:
+    static constexpr int CHUNK_SIZE = 4096;
+    static constexpr int MAX_CONFIGS = 32;
+    static constexpr int MAX_RUNNING = 16;      // Continuous emitters alive at once
+    static constexpr float MIN_LIFE = 1e-3f;    // Lifetimes are clamped to this; submit() divides by them
+
+    // Running-emitter handle = slot index (low HANDLE_SLOT_BITS) + the slot's
+    // generation, bumped by stop() and clear(), so a handle kept past its
+    // emitter is ignored rather than moving or stopping the slot's next user
+    static constexpr int HANDLE_SLOT_BITS = 8;
+    static constexpr int HANDLE_SLOT_MASK = (1 << HANDLE_SLOT_BITS) - 1;
+    static constexpr int HANDLE_GENERATION_MASK = (1 << (31 - HANDLE_SLOT_BITS)) - 1;
+    static_assert(MAX_RUNNING <= HANDLE_SLOT_MASK + 1, "ParticleSystem: MAX_RUNNING exceeds HANDLE_SLOT_BITS");
 
-        return true;
+    explicit ParticleSystem(int capacity, ThreadPool& pool = ThreadPool::getInstance())
+        : m_pool(&pool), m_capacity(capacity), m_current(0), m_configCount(0), m_dropped(0)
+    {
+        MemoryScope scope(MemTag::Particles);
+        m_arrays[0].reserve(capacity);
+        m_arrays[1].reserve(capacity);
+        m_chunkCounts.reserve(chunkCount(capacity));
     }
 
-    void draw(sf::RenderWindow& window)
+    // Load time; returns the id for burst()/start(), or -1 when the table is full.
+    // Lifetimes must be positive (release builds clamp them to MIN_LIFE)
+    int addEmitter(const EmitterConfig& config)
     {
-        window.draw(shape);
+        assert(config.lifeMin > 0.f && config.lifeMax >= config.lifeMin &&
+               "ParticleSystem::addEmitter: lifetimes must be positive, lifeMin <= lifeMax");
+        if (m_configCount >= MAX_CONFIGS)
+            return -1;
+        EmitterConfig& stored = m_configs[m_configCount];
+        stored = config;
+        stored.lifeMin = std::max(stored.lifeMin, MIN_LIFE);
+        stored.lifeMax = std::max(stored.lifeMax, stored.lifeMin);
+        return m_configCount++;
     }
-};
 
-// Particle system using DynamicArray
-class ParticleSystem
-{
-public:
-    ParticleSystem() = default;
+    const EmitterConfig& getEmitter(int id) const
+    {
+        assert(isEmitter(id) && "ParticleSystem::getEmitter: unregistered id");
+        return m_configs[id];
+    }
 
-    void emit(sf::Vector2f position, int count, sf::Color color)
+    bool isEmitter(int id) const { return id >= 0 && id < m_configCount; }
+
+    // One-shot spawn of the config's burst count (or `count` when given);
+    // ignored for an id addEmitter() never returned (e.g. its -1)
+    void burst(int id, sf::Vector2f position, int count = -1)
     {
-        for (int i = 0; i < count; ++i)
+        if (!isEmitter(id))
+            return;
+        spawn(id, position, count < 0 ? m_configs[id].burst : count);
+    }
+
+    // Continuous emitter at the config's rate; returns a handle, or -1 when
+    // MAX_RUNNING are already going or the id is not registered
+    int start(int id, sf::Vector2f position)
+    {
+        if (!isEmitter(id))
+            return -1;
+        for (int i = 0; i < MAX_RUNNING; ++i)
         {
-            float angle = static_cast<float>(std::rand()) / RAND_MAX * 6.28318f;
-            float speed = 50.f + static_cast<float>(std::rand()) / RAND_MAX * 150.f;
-            sf::Vector2f vel(std::cos(angle) * speed, std::sin(angle) * speed - 100.f);
-            
-            float life = 0.5f + static_cast<float>(std::rand()) / RAND_MAX * 0.5f;
-            
-            sf::Color endColor(color.r / 2, color.g / 2, color.b / 2, 0);
-            m_particles.push_back(Particle(position, vel, life, color, endColor));
+            RunningEmitter& emitter = m_running[i];
+            if (emitter.config < 0)
+            {
+                emitter.config = id;
+                emitter.position = position;
+                emitter.pending = 0.f;
+                return (emitter.generation << HANDLE_SLOT_BITS) | i;
+            }
         }
+        return -1;
+    }
+
+    // False for -1, out-of-range values and handles whose emitter was stopped
+    bool isRunning(int handle) const { return runningSlot(handle) >= 0; }
+
+    // moveEmitter()/stop() ignore handles that are not running (see above)
+    void moveEmitter(int handle, sf::Vector2f position)
+    {
+        int slot = runningSlot(handle);
+        if (slot >= 0)
+            m_running[slot].position = position;
+    }
+
+    void stop(int handle)
+    {
+        int slot = runningSlot(handle);
+        if (slot >= 0)
+            release(m_running[slot]);
     }
 
     void update(float dt)
     {
-        // Create new array with alive particles only
-        DynamicArray<Particle> alive;
-        for (int i = 0; i < m_particles.size(); ++i)
+        ProfileScope profile(ProfileSection::Particles);
+
+        // Running emitters carry fractional particles over to the next frame
+        for (RunningEmitter& emitter : m_running)
         {
-            if (m_particles[i].update(dt))
-                alive.push_back(m_particles[i]);
+            if (emitter.config < 0)
+                continue;
+            emitter.pending += m_configs[emitter.config].rate * dt;
+            int count = static_cast<int>(emitter.pending);
+            emitter.pending -= count;
+            spawn(emitter.config, emitter.position, count);
         }
-        m_particles = alive;
+
+        const Arrays& src = m_arrays[m_current];
+        Arrays& dst = m_arrays[1 - m_current];
+        const EmitterConfig* configs = m_configs;
+        int count = src.life.size();
+        int chunks = chunkCount(count);
+
+        m_chunkCounts.resize(chunks);
+        m_pool->parallelFor(chunks, [&](int c) {
+            int end = chunkEnd(c, count);
+            int alive = 0;
+            for (int i = c * CHUNK_SIZE; i < end; ++i)
+                alive += src.life[i] - dt > 0.f;
+            m_chunkCounts[c] = alive;
+        });
+
+        // Exclusive prefix sum: where each chunk's survivors land
+        int total = 0;
+        for (int c = 0; c < chunks; ++c)
+        {
+            int alive = m_chunkCounts[c];
+            m_chunkCounts[c] = total;
+            total += alive;
+        }
+
+        dst.resize(total);      // Within the reserved capacity
+
+        m_pool->parallelFor(chunks, [&](int c) {
+            int end = chunkEnd(c, count);
+            int out = m_chunkCounts[c];
+            for (int i = c * CHUNK_SIZE; i < end; ++i)
+            {
+                float life = src.life[i] - dt;
+                if (life <= 0.f)
+                    continue;
+
+                const EmitterConfig& config = configs[src.emitter[i]];
+                float keep = std::max(0.f, 1.f - config.drag * dt);
+                float vy = src.vy[i];
+                dst.x[out] = src.x[i] + src.vx[i] * dt;
+                dst.y[out] = src.y[i] + vy * dt;
+                dst.vx[out] = src.vx[i] * keep;
+                dst.vy[out] = (vy + config.gravity * dt) * keep;
+                dst.life[out] = life;
+                dst.maxLife[out] = src.maxLife[i];
+                dst.emitter[out] = src.emitter[i];
+                out++;
+            }
+        });
+
+        m_current = 1 - m_current;
     }
 
-    void draw(sf::RenderWindow& window)
+    // Builds this frame's quads into a render snapshot (chunks in parallel);
+    // the renderer never reads the live system, which the simulation owns
+    void submit(ParticleBatch& batch) const
     {
-        for (int i = 0; i < m_particles.size(); ++i)
+        const Arrays& a = m_arrays[m_current];
+        const EmitterConfig* configs = m_configs;
+        int count = a.life.size();
         {
-            m_particles[i].draw(window);
+            MemoryScope scope(MemTag::Particles);
+            batch.m_vertices.resize(count * 6);     // Free once reserve()d for the capacity
         }
+        sf::Vertex* vertices = batch.m_vertices.data();
+
+        m_pool->parallelFor(chunkCount(count), [&](int c) {
+            int end = chunkEnd(c, count);
+            for (int i = c * CHUNK_SIZE; i < end; ++i)
+            {
+                // Size and colour curves over the lifetime
+                const EmitterConfig& config = configs[a.emitter[i]];
+                float t = 1.f - a.life[i] / a.maxLife[i];
+                const sf::Color& s = config.colorStart;
+                const sf::Color& e = config.colorEnd;
+                sf::Color color(
+                    static_cast<std::uint8_t>(s.r + t * (e.r - s.r)),
+                    static_cast<std::uint8_t>(s.g + t * (e.g - s.g)),
+                    static_cast<std::uint8_t>(s.b + t * (e.b - s.b)),
+                    static_cast<std::uint8_t>(s.a + t * (e.a - s.a)));
+                float half = (config.sizeStart + t * (config.sizeEnd - config.sizeStart)) / 2.f;
+
+                sf::Vector2f topLeft(a.x[i] - half, a.y[i] - half);
+                sf::Vector2f topRight(a.x[i] + half, a.y[i] - half);
+                sf::Vector2f bottomLeft(a.x[i] - half, a.y[i] + half);
+                sf::Vector2f bottomRight(a.x[i] + half, a.y[i] + half);
+
+                sf::Vertex* v = vertices + i * 6;
+                v[0] = { topLeft, color };
+                v[1] = { topRight, color };
+                v[2] = { bottomLeft, color };
+                v[3] = { bottomLeft, color };
+                v[4] = { topRight, color };
+                v[5] = { bottomRight, color };
+            }
+        });
     }
 
+    int size() const { return m_arrays[m_current].life.size(); }
+    int capacity() const { return m_capacity; }
+
+    // Spawns refused because the pool was full, since construction
+    long long getDropped() const { return m_dropped; }
+
+    // Kills every particle and stops running emitters; configs stay registered
     void clear()
     {
-        m_particles = DynamicArray<Particle>();
+        m_arrays[m_current].clear();
+        for (RunningEmitter& emitter : m_running)
+        {
+            if (emitter.config >= 0)
+                release(emitter);
+        }
     }
 
 private:
-    DynamicArray<Particle> m_particles;
+    template<typename T>
+    using Column = DynamicArray<T, CacheLineAllocator>;
+
+    struct Arrays
+    {
+        Column<float> x, y;
+        Column<float> vx, vy;
+        Column<float> life, maxLife;
+        Column<std::uint8_t> emitter;       // Index into m_configs
+
+        void reserve(int count)
+        {
+            x.reserve(count);
+            y.reserve(count);
+            vx.reserve(count);
+            vy.reserve(count);
+            life.reserve(count);
+            maxLife.reserve(count);
+            emitter.reserve(count);
+        }
+
+        void resize(int count)
+        {
+            x.resize(count);
+            y.resize(count);
+            vx.resize(count);
+            vy.resize(count);
+            life.resize(count);
+            maxLife.resize(count);
+            emitter.resize(count);
+        }
+
+        void clear()
+        {
+            x.clear();
+            y.clear();
+            vx.clear();
+            vy.clear();
+            life.clear();
+            maxLife.clear();
+            emitter.clear();
+        }
+    };
+
+    struct RunningEmitter
+    {
+        int config = -1;                    // -1 = free slot
+        sf::Vector2f position;
+        float pending = 0.f;                // Fractional particles owed
+        int generation = 0;                 // Bumped on release; part of the handle
+    };
+
+    int runningSlot(int handle) const
+    {
+        if (handle < 0)
+            return -1;
+        int slot = handle & HANDLE_SLOT_MASK;
+        if (slot >= MAX_RUNNING)
+            return -1;
+        const RunningEmitter& emitter = m_running[slot];
+        return emitter.config >= 0 && emitter.generation == (handle >> HANDLE_SLOT_BITS) ? slot : -1;
+    }
+
+    static void release(RunningEmitter& emitter)
+    {
+        emitter.config = -1;
+        emitter.generation = (emitter.generation + 1) & HANDLE_GENERATION_MASK;
+    }
+
+    static float randomRange(float low, float high)
+    {
+        return low + static_cast<float>(std::rand()) / RAND_MAX * (high - low);
+    }
+
+    void spawn(int id, sf::Vector2f position, int count)
+    {
+        Arrays& a = m_arrays[m_current];
+        int room = m_capacity - a.life.size();
+        if (count > room)
+        {
+            m_dropped += count - room;
+            count = room;
+        }
+
+        const EmitterConfig& config = m_configs[id];
+        for (int i = 0; i < count; ++i)
+        {
+            float angle = (config.direction + randomRange(-0.5f, 0.5f) * config.spread) * 3.14159265f / 180.f;
+            float speed = randomRange(config.speedMin, config.speedMax);
+            float life = randomRange(config.lifeMin, config.lifeMax);
+
+            a.x.push_back(position.x);
+            a.y.push_back(position.y);
+            a.vx.push_back(std::cos(angle) * speed + config.velocityOffset.x);
+            a.vy.push_back(std::sin(angle) * speed + config.velocityOffset.y);
+            a.life.push_back(life);
+            a.maxLife.push_back(life);
+            a.emitter.push_back(static_cast<std::uint8_t>(id));
+        }
+    }
+
+    static int chunkCount(int count)
+    {
+        return (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    }
+
+    static int chunkEnd(int chunk, int count)
+    {
+        return std::min(count, (chunk + 1) * CHUNK_SIZE);
+    }
+
+    ThreadPool* m_pool;
+    int m_capacity;
+    Arrays m_arrays[2];                 // Live set and the spare that update() compacts into
+    int m_current;
+    DynamicArray<int> m_chunkCounts;    // Survivors per chunk, then output offsets
+    EmitterConfig m_configs[MAX_CONFIGS];
+    int m_configCount;
+    RunningEmitter m_running[MAX_RUNNING];
+    long long m_dropped;
 };
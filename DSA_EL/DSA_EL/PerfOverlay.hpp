@@ -0,0 +1,241 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "UI.hpp"
+#include "Colors.hpp"
+#include "Profiler.hpp"
+#include "MemoryTracker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+// ==================== PERF OVERLAY ====================
+// Toggleable telemetry panel (F3). One draw per frame when visible: the
+// Panel and its multi-line Label are rendered into a cached layer when the
+// text changes (a few times per second), and each frame a single Triangles
+// array carries the layer quad plus the frame-time graph, whose line quads
+// sample a white texel reserved in the same layer. Falls back to drawing
+// the panel directly when render textures are unavailable.
+class PerfOverlay
+{
+public:
+    static constexpr int GRAPH_SAMPLES = 120;
+
+    PerfOverlay(sf::Font* font, float windowWidth)
+        : m_panel({ PANEL_WIDTH, PANEL_HEIGHT }, { OUTLINE, OUTLINE }),
+          m_label("", font, 12, { 10.f, 6.f }),
+          m_batch(sf::PrimitiveType::Triangles),
+          m_origin(windowWidth - PANEL_WIDTH - 10.f, 10.f),
+          m_sinceRefresh(REFRESH_MS)
+    {
+        m_panel.setOutline(OUTLINE, Colors::Accent);
+        m_panel.addChild(&m_label);
+
+        MemoryScope scope(MemTag::UI);
+        m_layerReady = m_layer.resize({ static_cast<unsigned>(LAYER_WIDTH), static_cast<unsigned>(LAYER_HEIGHT + WHITE_SIZE) });
+        if (m_layerReady)
+            m_layer.setSmooth(true);
+        else
+        {
+            std::cerr << "[PerfOverlay] RenderTexture unavailable, drawing the panel directly\n";
+            m_panel.setPosition(m_origin);
+        }
+    }
+
+    void toggle()
+    {
+        m_visible = !m_visible;
+        Profiler::getInstance().setEnabled(m_visible);
+        m_sinceRefresh = REFRESH_MS;
+    }
+
+    bool isVisible() const { return m_visible; }
+
+    // Call once per frame after Profiler::endFrame()
+    void update()
+    {
+        if (!m_visible)
+            return;
+
+        const Profiler& p = Profiler::getInstance();
+        rebuildGraph(p);
+
+        m_sinceRefresh += p.getFrameMs();
+        if (m_sinceRefresh >= REFRESH_MS)
+        {
+            m_sinceRefresh = 0.f;
+            rebuildText(p);
+            m_layerDirty = true;
+        }
+    }
+
+    // Drawn on the window after the scaled scene, so it stays sharp at any render scale
+    void draw(sf::RenderTarget& target, const sf::View& view)
+    {
+        if (!m_visible)
+            return;
+
+        target.setView(view);
+        Profiler& profiler = Profiler::getInstance();
+
+        if (!m_layerReady)
+        {
+            m_panel.draw(target);
+            if (m_batch.getVertexCount() > LAYER_VERTICES)
+                target.draw(&m_batch[LAYER_VERTICES], m_batch.getVertexCount() - LAYER_VERTICES, sf::PrimitiveType::Triangles);
+            profiler.count(PerfCounter::DrawCalls, 3);
+            return;
+        }
+
+        if (m_layerDirty)
+        {
+            redrawLayer();
+            profiler.count(PerfCounter::DrawCalls, 3);
+        }
+
+        // Alpha-blending into a transparent layer leaves premultiplied colour
+        sf::RenderStates states(PREMULTIPLIED);
+        states.texture = &m_layer.getTexture();
+        target.draw(m_batch, states);
+        profiler.count(PerfCounter::DrawCalls, 1);
+    }
+
+private:
+    static constexpr float PANEL_WIDTH = 250.f;
+    static constexpr float PANEL_HEIGHT = 215.f;
+    static constexpr float GRAPH_HEIGHT = 50.f;
+    static constexpr float GRAPH_MAX_MS = 50.f;     // top of the graph
+    static constexpr float REFRESH_MS = 250.f;
+
+    // Layer: the outlined panel, then a white strip below it for the graph
+    static constexpr float OUTLINE = 1.f;
+    static constexpr float LAYER_WIDTH = PANEL_WIDTH + 2.f * OUTLINE;
+    static constexpr float LAYER_HEIGHT = PANEL_HEIGHT + 2.f * OUTLINE;
+    static constexpr float WHITE_SIZE = 2.f;
+    static constexpr std::size_t LAYER_VERTICES = 6;
+    static inline const sf::BlendMode PREMULTIPLIED{ sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha };
+
+    void redrawLayer()
+    {
+        m_layer.clear(sf::Color::Transparent);
+        m_panel.draw(m_layer);      // Panel and its label in one traversal
+
+        sf::RectangleShape white({ LAYER_WIDTH, WHITE_SIZE });
+        white.setPosition({ 0.f, LAYER_HEIGHT });
+        m_layer.draw(white);
+        m_layer.display();
+        m_layerDirty = false;
+    }
+
+    void rebuildGraph(const Profiler& p)
+    {
+        float left = m_origin.x + 10.f;
+        float bottom = m_origin.y + PANEL_HEIGHT - 8.f;
+        float width = PANEL_WIDTH - 20.f;
+        float step = width / (GRAPH_SAMPLES - 1);
+
+        m_batch.clear();
+        addLayerQuad();
+
+        // 60 and 30 FPS reference lines
+        addLine(left, bottom - msToHeight(1000.f / 60.f), left + width, bottom - msToHeight(1000.f / 60.f), Colors::Success);
+        addLine(left, bottom - msToHeight(1000.f / 30.f), left + width, bottom - msToHeight(1000.f / 30.f), Colors::Danger);
+
+        int count = std::min(p.getHistoryCount(), GRAPH_SAMPLES);
+        int first = p.getHistoryCount() - count;
+        for (int i = 1; i < count; ++i)
+        {
+            float x0 = left + (i - 1) * step;
+            float x1 = left + i * step;
+            float ms = p.getHistory(first + i);
+            sf::Color color = ms > 1000.f / 30.f ? Colors::Danger : (ms > 1000.f / 58.f ? Colors::Warning : Colors::Text);
+            addLine(x0, bottom - msToHeight(p.getHistory(first + i - 1)), x1, bottom - msToHeight(ms), color);
+        }
+    }
+
+    void rebuildText(const Profiler& p)
+    {
+        float avgMs = p.getAverageFrameMs();
+        float low1 = p.getPercentileFrameMs(0.99f);
+        float low01 = p.getPercentileFrameMs(0.999f);
+
+        char allocs[32];
+        if (MemoryTracker::isEnabled())
+            std::snprintf(allocs, sizeof(allocs), "%lld", MemoryTracker::getFrameStats().allocs);
+        else
+            std::snprintf(allocs, sizeof(allocs), "n/a");
+
+        char buf[512];
+        std::snprintf(buf, sizeof(buf),
+            "FPS %.0f  (%.2f ms)\n"
+            "1%% low %.0f   0.1%% low %.0f\n"
+            "update    %.2f ms\n"
+            "  collision %.2f ms\n"
+            "  particles %.2f ms\n"
+            "render    %.2f ms  (%d%% res)\n"
+            "draw calls %d\n"
+            "particles %d   obstacles %d\n"
+            "allocs/frame %s",
+            avgMs > 0.f ? 1000.f / avgMs : 0.f, avgMs,
+            low1 > 0.f ? 1000.f / low1 : 0.f, low01 > 0.f ? 1000.f / low01 : 0.f,
+            p.getSectionMs(ProfileSection::Update),
+            p.getSectionMs(ProfileSection::Collision),
+            p.getSectionMs(ProfileSection::Particles),
+            p.getSectionMs(ProfileSection::Render), p.getCounter(PerfCounter::RenderScale),
+            p.getCounter(PerfCounter::DrawCalls),
+            p.getCounter(PerfCounter::Particles), p.getCounter(PerfCounter::Obstacles),
+            allocs);
+        m_label.setText(buf);
+    }
+
+    float msToHeight(float ms) const
+    {
+        return std::min(ms, GRAPH_MAX_MS) / GRAPH_MAX_MS * GRAPH_HEIGHT;
+    }
+
+    // The cached panel, placed so the panel itself sits at m_origin
+    void addLayerQuad()
+    {
+        sf::Vector2f topLeft(m_origin.x - OUTLINE, m_origin.y - OUTLINE);
+        sf::Vector2f size(LAYER_WIDTH, LAYER_HEIGHT);
+        addQuad(topLeft, topLeft + sf::Vector2f(size.x, 0.f), topLeft + size, topLeft + sf::Vector2f(0.f, size.y),
+            { 0.f, 0.f }, { size.x, 0.f }, size, { 0.f, size.y }, sf::Color::White);
+    }
+
+    // One-pixel-wide quad along the segment, tinted from the white texel
+    void addLine(float x0, float y0, float x1, float y1, sf::Color color)
+    {
+        float dx = x1 - x0;
+        float dy = y1 - y0;
+        float length = std::sqrt(dx * dx + dy * dy);
+        if (length <= 0.f)
+            return;
+
+        sf::Vector2f n(-dy / length * 0.5f, dx / length * 0.5f);
+        sf::Vector2f a(x0, y0);
+        sf::Vector2f b(x1, y1);
+        sf::Vector2f white(WHITE_SIZE / 2.f, LAYER_HEIGHT + WHITE_SIZE / 2.f);
+        addQuad(a + n, b + n, b - n, a - n, white, white, white, white, color);
+    }
+
+    void addQuad(sf::Vector2f p0, sf::Vector2f p1, sf::Vector2f p2, sf::Vector2f p3,
+                 sf::Vector2f t0, sf::Vector2f t1, sf::Vector2f t2, sf::Vector2f t3, sf::Color color)
+    {
+        m_batch.append(sf::Vertex{ p0, color, t0 });
+        m_batch.append(sf::Vertex{ p1, color, t1 });
+        m_batch.append(sf::Vertex{ p3, color, t3 });
+        m_batch.append(sf::Vertex{ p3, color, t3 });
+        m_batch.append(sf::Vertex{ p1, color, t1 });
+        m_batch.append(sf::Vertex{ p2, color, t2 });
+    }
+
+    Panel m_panel;
+    Label m_label;
+    sf::RenderTexture m_layer;
+    sf::VertexArray m_batch;        // Layer quad, then the graph's line quads
+    sf::Vector2f m_origin;
+    float m_sinceRefresh;
+    bool m_layerReady = false;
+    bool m_layerDirty = true;
+    bool m_visible = false;
+};
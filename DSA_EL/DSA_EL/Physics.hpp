@@ -1,76 +1,157 @@
 #pragma once
 #include <SFML/Graphics.hpp>
-#include <cmath>
+#include "Collision.hpp"
+#include <algorithm>
+#include <cstdint>
 
+// ================= PLATFORM PHYSICS =================
+// Moving boxes against static platform boxes held in plain arrays. A body
+// reports its step as from -> to (velocity * dt, already integrated); the
+// step is swept against every platform passed in, the earliest contact
+// stops it on that axis, and what is left of the step slides along the
+// other axis. Hits are found along the step itself, and a body at rest is
+// grounded by a fixed SKIN probe, so landing, side and ceiling contacts
+// behave the same at any frame rate.
+//
+// Callers pass only the platforms near the body (rangeX over an array
+// sorted by left edge, or a slice of an obstacle stream), which keeps the
+// cost flat however many platforms the level holds.
 namespace Physics
 {
-    // Improved platform landing detection
-    // Returns true if player landed on platform from above
-    inline bool landOnPlatform(
-        sf::RectangleShape& player,
-        float& yVelocity,
-        const sf::RectangleShape& platform)
+    enum PlatformFlags : std::uint8_t
     {
-        sf::FloatRect playerBounds = player.getGlobalBounds();
-        sf::FloatRect platBounds = platform.getGlobalBounds();
+        PlatformSolid = 0,
+        PlatformOneWay = 1 << 0,        // Landable from above; passed through from below and the sides
+    };
 
-        float playerBottom = playerBounds.position.y + playerBounds.size.y;
-        float playerTop = playerBounds.position.y;
-        float playerLeft = playerBounds.position.x;
-        float playerRight = playerBounds.position.x + playerBounds.size.x;
-        float playerCenterX = playerBounds.position.x + playerBounds.size.x / 2.f;
-
-        float platTop = platBounds.position.y;
-        float platBottom = platBounds.position.y + platBounds.size.y;
-        float platLeft = platBounds.position.x;
-        float platRight = platBounds.position.x + platBounds.size.x;
+    struct Platform
+    {
+        sf::FloatRect box;
+        std::uint8_t flags = PlatformSolid;
+    };
 
-        // Check if player is horizontally aligned with platform
-        bool horizontalOverlap = playerRight > platLeft + 5.f && playerLeft < platRight - 5.f;
+    // Indices into the platform array passed to resolve(); -1 = no contact
+    struct Contacts
+    {
+        int ground = -1;                // Landed on (or still standing on)
+        int ceiling = -1;
+        int wall = -1;                  // Hit from the side
+        float wallNormal = 0.f;         // -1: body moving right hit a left face; +1: the reverse
 
-        // Check if player is falling (or stationary) and coming from above
-        bool fallingDown = yVelocity >= 0.f;
+        bool grounded() const { return ground >= 0; }
+    };
 
-        // Check if player's bottom is near platform top (within tolerance)
-        float penetration = playerBottom - platTop;
-        bool nearTop = penetration > 0.f && penetration < 30.f;
+    // Contacts count once the boxes are this close, so a body resting exactly
+    // on a platform (up to float rounding) is never seen as already inside it;
+    // a body whose feet end the step within SKIN of a top is standing on it
+    constexpr float SKIN = 0.01f;
+    constexpr int MAX_ITERATIONS = 3;   // One contact per axis, plus a corner
 
-        // Also ensure player wasn't too far below (to avoid snapping from below)
-        bool wasAbove = playerBottom - yVelocity * 0.017f <= platTop + 15.f;
+    inline Contacts resolve(const sf::FloatRect& from, sf::FloatRect& to, sf::Vector2f& velocity,
+                            const Platform* platforms, int count)
+    {
+        Contacts contacts;
+        sf::Vector2f position = from.position;
+        sf::Vector2f remaining = to.position - from.position;
+        const sf::Vector2f skin(SKIN, SKIN);
 
-        if (horizontalOverlap && fallingDown && nearTop && wasAbove)
+        for (int iteration = 0; iteration < MAX_ITERATIONS; ++iteration)
         {
-            // Snap player to platform top
-            player.setPosition({
-                player.getPosition().x,
-                platTop - playerBounds.size.y
-            });
+            if (remaining.x == 0.f && remaining.y == 0.f)
+                break;
 
-            yVelocity = 0.f;
-            return true;
-        }
+            sf::FloatRect box(position + skin, from.size - skin * 2.f);
+            float firstTime = 2.f;
+            int first = -1;
+            sf::Vector2f firstNormal;
 
-        return false;
-    }
+            for (int i = 0; i < count; ++i)
+            {
+                Collision::SweepHit hit;
+                if (!Collision::sweepAabb(box, remaining, platforms[i].box, hit))
+                    continue;
+                if (hit.normal.x == 0.f && hit.normal.y == 0.f)
+                    continue;       // Started inside (rising through a one-way platform)
+                if ((platforms[i].flags & PlatformOneWay) && hit.normal.y >= 0.f)
+                    continue;       // One-way: only landings count
+                if (hit.time < firstTime)
+                {
+                    firstTime = hit.time;
+                    first = i;
+                    firstNormal = hit.normal;
+                }
+            }
 
-    // Check if player is standing on a platform (for grounded state)
-    inline bool isOnPlatform(
-        const sf::RectangleShape& player,
-        const sf::RectangleShape& platform)
-    {
-        sf::FloatRect playerBounds = player.getGlobalBounds();
-        sf::FloatRect platBounds = platform.getGlobalBounds();
+            if (first < 0)
+            {
+                position += remaining;
+                break;
+            }
 
-        float playerBottom = playerBounds.position.y + playerBounds.size.y;
-        float platTop = platBounds.position.y;
+            // Advance to the contact, then snap flush so rounding can't creep inside
+            position += remaining * firstTime;
+            remaining *= 1.f - firstTime;
+            const sf::FloatRect& p = platforms[first].box;
 
-        // Player is on platform if bottom is exactly at platform top
-        // and horizontally overlapping
-        bool onTop = std::abs(playerBottom - platTop) < 2.f;
-        bool horizontalOverlap = 
-            playerBounds.position.x + playerBounds.size.x > platBounds.position.x + 5.f &&
-            playerBounds.position.x < platBounds.position.x + platBounds.size.x - 5.f;
+            if (firstNormal.y != 0.f)
+            {
+                remaining.y = 0.f;
+                velocity.y = 0.f;
+                if (firstNormal.y < 0.f)
+                {
+                    position.y = p.position.y - from.size.y;
+                    contacts.ground = first;
+                }
+                else
+                {
+                    position.y = p.position.y + p.size.y;
+                    contacts.ceiling = first;
+                }
+            }
+            else
+            {
+                remaining.x = 0.f;
+                velocity.x = 0.f;
+                position.x = firstNormal.x < 0.f ? p.position.x - from.size.x : p.position.x + p.size.x;
+                contacts.wall = first;
+                contacts.wallNormal = firstNormal.x;
+            }
+        }
+
+        // Resting contact: a step too short to close the skin gap (a body
+        // standing still at a high frame rate) still counts as standing on
+        // a platform top within SKIN of its feet
+        if (contacts.ground < 0 && velocity.y >= 0.f)
+        {
+            float bottom = position.y + from.size.y;
+            float left = position.x + SKIN;
+            float right = position.x + from.size.x - SKIN;
+            for (int i = 0; i < count; ++i)
+            {
+                const sf::FloatRect& p = platforms[i].box;
+                float gap = p.position.y - bottom;
+                if (gap <= SKIN && gap >= -SKIN && left < p.position.x + p.size.x && right > p.position.x)
+                {
+                    position.y = p.position.y - from.size.y;
+                    velocity.y = 0.f;
+                    contacts.ground = i;
+                    break;
+                }
+            }
+        }
 
-        return onTop && horizontalOverlap;
+        to.position = position;
+        return contacts;
+    }
+
+    // Platforms sorted by left edge, none wider than maxWidth: the index
+    // range [begin, end) that can touch the span [minX, maxX] (binary search)
+    inline void rangeX(const Platform* sorted, int count, float minX, float maxX, float maxWidth, int& begin, int& end)
+    {
+        const Platform* last = sorted + count;
+        begin = static_cast<int>(std::lower_bound(sorted, last, minX - maxWidth,
+            [](const Platform& p, float x) { return p.box.position.x < x; }) - sorted);
+        end = static_cast<int>(std::upper_bound(sorted + begin, last, maxX,
+            [](float x, const Platform& p) { return x < p.box.position.x; }) - sorted);
     }
 }
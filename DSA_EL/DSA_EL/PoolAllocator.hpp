@@ -0,0 +1,118 @@
+#pragma once
+#include <cstddef>
+#include <new>
+
+// ================= POOL ALLOCATOR =================
+// Fixed-size blocks carved from slabs of BLOCKS_PER_SLAB. Freed blocks go on
+// an intrusive free list, so allocate/deallocate are O(1) pointer swaps and
+// only a fresh slab touches the global heap. Returns raw storage; callers
+// placement-new and destroy the object themselves.
+template<typename T, int BLOCKS_PER_SLAB = 64>
+class PoolAllocator
+{
+public:
+    PoolAllocator() : m_freeList(nullptr), m_slabs(nullptr), m_live(0), m_slabCount(0) {}
+
+    ~PoolAllocator()
+    {
+        while (m_slabs)
+        {
+            Slab* next = m_slabs->next;
+            delete m_slabs;
+            m_slabs = next;
+        }
+    }
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    T* allocate()
+    {
+        if (!m_freeList)
+            grow();
+
+        Block* block = m_freeList;
+        m_freeList = block->next;
+        m_live++;
+        return reinterpret_cast<T*>(block->storage);
+    }
+
+    void deallocate(T* ptr)
+    {
+        if (!ptr)
+            return;
+
+        Block* block = reinterpret_cast<Block*>(ptr);
+        block->next = m_freeList;
+        m_freeList = block;
+        m_live--;
+    }
+
+    int liveCount() const { return m_live; }
+    int capacity() const { return m_slabCount * BLOCKS_PER_SLAB; }
+    int slabCount() const { return m_slabCount; }
+
+    // Process-wide pool shared by every container of this node type
+    static PoolAllocator& shared()
+    {
+        static PoolAllocator instance;
+        return instance;
+    }
+
+private:
+    union Block
+    {
+        Block* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Slab
+    {
+        Slab* next;
+        Block blocks[BLOCKS_PER_SLAB];
+    };
+
+    void grow()
+    {
+        Slab* slab = new Slab;
+        slab->next = m_slabs;
+        m_slabs = slab;
+        m_slabCount++;
+
+        // Thread the new blocks onto the free list
+        for (int i = BLOCKS_PER_SLAB - 1; i >= 0; --i)
+        {
+            slab->blocks[i].next = m_freeList;
+            m_freeList = &slab->blocks[i];
+        }
+    }
+
+    Block* m_freeList;
+    Slab* m_slabs;
+    int m_live;
+    int m_slabCount;
+};
+
+// ================= HEAP ALLOCATOR =================
+// Same interface as PoolAllocator but straight to the global heap
+// (one malloc per node). Useful as a baseline.
+template<typename T>
+class HeapAllocator
+{
+public:
+    T* allocate()
+    {
+        return static_cast<T*>(::operator new(sizeof(T)));
+    }
+
+    void deallocate(T* ptr)
+    {
+        ::operator delete(ptr);
+    }
+
+    static HeapAllocator& shared()
+    {
+        static HeapAllocator instance;
+        return instance;
+    }
+};
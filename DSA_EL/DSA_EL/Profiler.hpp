@@ -0,0 +1,187 @@
+#pragma once
+#include <chrono>
+#include <algorithm>
+#include <mutex>
+
+// Timed sections shown in the performance overlay
+enum class ProfileSection
+{
+    Update,
+    Collision,
+    Particles,
+    Render,
+    Count
+};
+
+// Per-frame counters (summed during the frame, reset at endFrame)
+enum class PerfCounter
+{
+    DrawCalls,
+    Particles,
+    Obstacles,
+    RenderScale,    // Offscreen resolution, percent of virtual
+    Count
+};
+
+// ================= PROFILER =================
+// Collects per-section milliseconds, counters and a rolling frame-time
+// history. Does nothing until enabled, so hidden telemetry costs one branch
+// per scope. The simulation and render threads both report into the
+// current frame, so accumulation is locked; setEnabled and the getters are
+// main-thread only, between frames.
+class Profiler
+{
+public:
+    static constexpr int HISTORY = 1000;   // frames kept for the lows
+
+    static Profiler& getInstance()
+    {
+        static Profiler instance;
+        return instance;
+    }
+
+    void setEnabled(bool enabled)
+    {
+        if (enabled && !m_enabled)
+        {
+            // Start a fresh history rather than mixing in stale frames
+            m_historyCount = 0;
+            m_historyHead = 0;
+            m_lastFrameEnd = Clock::now();
+        }
+        m_enabled = enabled;
+    }
+
+    bool isEnabled() const { return m_enabled; }
+
+    void addTime(ProfileSection section, float ms)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_current.sectionMs[static_cast<int>(section)] += ms;
+    }
+
+    void count(PerfCounter counter, int amount = 1)
+    {
+        if (!m_enabled)
+            return;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_current.counters[static_cast<int>(counter)] += amount;
+    }
+
+    // Close the frame: publish this frame's numbers and record its duration
+    void endFrame()
+    {
+        if (!m_enabled)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Clock::time_point now = Clock::now();
+        float frameMs = std::chrono::duration<float, std::milli>(now - m_lastFrameEnd).count();
+        m_lastFrameEnd = now;
+
+        m_last = m_current;
+        m_last.frameMs = frameMs;
+        m_current = FrameData();
+
+        m_history[m_historyHead] = frameMs;
+        m_historyHead = (m_historyHead + 1) % HISTORY;
+        if (m_historyCount < HISTORY)
+            m_historyCount++;
+    }
+
+    float getSectionMs(ProfileSection section) const { return m_last.sectionMs[static_cast<int>(section)]; }
+    int getCounter(PerfCounter counter) const { return m_last.counters[static_cast<int>(counter)]; }
+    float getFrameMs() const { return m_last.frameMs; }
+
+    int getHistoryCount() const { return m_historyCount; }
+
+    // i = 0 is the oldest sample kept
+    float getHistory(int i) const
+    {
+        int start = (m_historyCount < HISTORY) ? 0 : m_historyHead;
+        return m_history[(start + i) % HISTORY];
+    }
+
+    float getAverageFrameMs() const
+    {
+        if (m_historyCount == 0)
+            return 0.f;
+        float sum = 0.f;
+        for (int i = 0; i < m_historyCount; ++i)
+            sum += m_history[i];
+        return sum / m_historyCount;
+    }
+
+    // Frame time at the given percentile (0.99 -> "1% low" frame time)
+    float getPercentileFrameMs(float percentile) const
+    {
+        if (m_historyCount == 0)
+            return 0.f;
+
+        float sorted[HISTORY];
+        std::copy(m_history, m_history + m_historyCount, sorted);
+        int k = std::min(m_historyCount - 1, static_cast<int>(percentile * m_historyCount));
+        std::nth_element(sorted, sorted + k, sorted + m_historyCount);
+        return sorted[k];
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct FrameData
+    {
+        float sectionMs[static_cast<int>(ProfileSection::Count)] = {};
+        int counters[static_cast<int>(PerfCounter::Count)] = {};
+        float frameMs = 0.f;
+    };
+
+    Profiler() = default;
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    bool m_enabled = false;
+    std::mutex m_mutex;         // Guards m_current and the hand-over to m_last
+    FrameData m_current;
+    FrameData m_last;
+
+    float m_history[HISTORY] = {};
+    int m_historyHead = 0;
+    int m_historyCount = 0;
+    Clock::time_point m_lastFrameEnd;
+};
+
+// Adds the enclosing block's wall time to a section (skipped while disabled)
+class ProfileScope
+{
+public:
+    explicit ProfileScope(ProfileSection section)
+        : m_section(section), m_active(Profiler::getInstance().isEnabled())
+    {
+        if (m_active)
+            m_start = std::chrono::steady_clock::now();
+    }
+
+    ~ProfileScope()
+    {
+        stop();
+    }
+
+    // End the measurement before the scope closes
+    void stop()
+    {
+        if (m_active)
+        {
+            float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+            Profiler::getInstance().addTime(m_section, ms);
+            m_active = false;
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ProfileSection m_section;
+    bool m_active;
+    std::chrono::steady_clock::time_point m_start;
+};
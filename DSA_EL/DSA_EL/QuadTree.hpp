@@ -1,35 +1,155 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "LinkedList.hpp"
+#include "PoolAllocator.hpp"
+#include "DynamicArray.hpp"
 
-// QuadTree for spatial partitioning (demonstration structure)
+// QuadTree for spatial partitioning (broad phase)
+// Items are stored in the deepest node that fully contains their bounds;
+// a node splits once it holds more than MAX_ITEMS. Item lists and child
+// nodes both come from slab pools, so clearing and rebuilding the tree
+// every frame recycles blocks instead of hitting the heap.
 struct QuadTree
 {
+    static constexpr int MAX_ITEMS = 8;
+    static constexpr int MAX_DEPTH = 8;
+
+    struct Item
+    {
+        int index;              // caller's id (entity index, array slot...)
+        sf::FloatRect bounds;
+    };
+
     sf::FloatRect boundary;
-    LinkedList<int> entities; // store indices of entities
+    LinkedList<Item> entities;
     QuadTree* children[4]{ nullptr, nullptr, nullptr, nullptr };
+    int depth;
+
+    QuadTree(sf::FloatRect bounds, int depth = 0) : boundary(bounds), depth(depth) {}
+
+    ~QuadTree()
+    {
+        clear();
+    }
+
+    QuadTree(const QuadTree&) = delete;
+    QuadTree& operator=(const QuadTree&) = delete;
+
+    // Drop all entities and return child nodes to the pool
+    void clear()
+    {
+        entities.clear();
+        for (int i = 0; i < 4; ++i)
+        {
+            if (children[i])
+            {
+                children[i]->~QuadTree();
+                nodePool().deallocate(children[i]);
+                children[i] = nullptr;
+            }
+        }
+    }
+
+    void insert(int entityIndex, const sf::FloatRect& bounds)
+    {
+        QuadTree* node = this;
+        while (node->children[0])
+        {
+            QuadTree* child = node->childContaining(bounds);
+            if (!child)
+                break;      // straddles a split line: stays here
+            node = child;
+        }
+
+        node->entities.push_front({ entityIndex, bounds });
+
+        if (!node->children[0] && node->entities.size() > MAX_ITEMS && node->depth < MAX_DEPTH)
+            node->subdivide();
+    }
+
+    // Appends the index of every item whose bounds overlap `area`
+    template<typename Alloc>
+    void query(const sf::FloatRect& area, DynamicArray<int, Alloc>& out) const
+    {
+        // The root also keeps items outside its boundary, so never skip it
+        if (depth > 0 && !overlaps(boundary, area))
+            return;
+
+        for (Node<Item>* n = entities.getHead(); n; n = n->next)
+        {
+            if (overlaps(n->data.bounds, area))
+                out.push_back(n->data.index);
+        }
 
-    QuadTree(sf::FloatRect bounds) : boundary(bounds) {}
+        if (children[0])
+            for (int i = 0; i < 4; ++i)
+                children[i]->query(area, out);
+    }
 
-    int getQuadrant(const sf::Vector2f& pos)
+    int nodeCount() const
     {
-        float midX = boundary.position.x + boundary.size.x / 2.f;
-        float midY = boundary.position.y + boundary.size.y / 2.f;
+        int count = 1;
+        if (children[0])
+            for (int i = 0; i < 4; ++i)
+                count += children[i]->nodeCount();
+        return count;
+    }
 
-        if (pos.x < midX && pos.y < midY) return 0; // TL
-        if (pos.x >= midX && pos.y < midY) return 1; // TR
-        if (pos.x < midX && pos.y >= midY) return 2; // BL
-        return 3; // BR
+    static PoolAllocator<QuadTree, 16>& nodePool()
+    {
+        return PoolAllocator<QuadTree, 16>::shared();
     }
 
-    void insert(int entityIndex, const sf::Vector2f& pos)
+private:
+    static bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b)
     {
-        int q = getQuadrant(pos);
-        entities.push_front(entityIndex);
+        return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+               a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
     }
 
-    LinkedList<int>& query(const sf::Vector2f&)
+    static bool contains(const sf::FloatRect& outer, const sf::FloatRect& inner)
     {
-        return entities;
+        return inner.position.x >= outer.position.x && inner.position.y >= outer.position.y &&
+               inner.position.x + inner.size.x <= outer.position.x + outer.size.x &&
+               inner.position.y + inner.size.y <= outer.position.y + outer.size.y;
+    }
+
+    QuadTree* childContaining(const sf::FloatRect& bounds) const
+    {
+        for (int i = 0; i < 4; ++i)
+            if (contains(children[i]->boundary, bounds))
+                return children[i];
+        return nullptr;
+    }
+
+    void subdivide()
+    {
+        sf::Vector2f half = boundary.size / 2.f;
+        sf::Vector2f p = boundary.position;
+        sf::FloatRect quads[4] = {
+            { p, half },                                    // TL
+            { { p.x + half.x, p.y }, half },                // TR
+            { { p.x, p.y + half.y }, half },                // BL
+            { { p.x + half.x, p.y + half.y }, half }        // BR
+        };
+        for (int i = 0; i < 4; ++i)
+            children[i] = new (nodePool().allocate()) QuadTree(quads[i], depth + 1);
+
+        // Push down every item that fits entirely inside one child
+        LinkedList<Item> keep;
+        Item item;
+        while (entities.pop_front(item))
+        {
+            QuadTree* child = childContaining(item.bounds);
+            if (child)
+                child->entities.push_front(item);
+            else
+                keep.push_front(item);
+        }
+        entities = std::move(keep);
+
+        for (int i = 0; i < 4; ++i)
+            if (children[i]->entities.size() > MAX_ITEMS && children[i]->depth < MAX_DEPTH)
+                children[i]->subdivide();
     }
 };
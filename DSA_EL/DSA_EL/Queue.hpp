@@ -1,4 +1,5 @@
 #pragma once
+#include <utility>
 
 template<typename T, int MAX_SIZE = 100>
 class Queue
@@ -17,12 +18,24 @@ public:
         return true;
     }
 
+    // Move-only values (e.g. std::unique_ptr) go in by move
+    bool push(T&& value)
+    {
+        if (count == MAX_SIZE)
+            return false; // queue full
+
+        data[rear] = std::move(value);
+        rear = (rear + 1) % MAX_SIZE;
+        count++;
+        return true;
+    }
+
     bool pop(T& out)
     {
         if (count == 0)
             return false; // queue empty
 
-        out = data[front];
+        out = std::move(data[front]);
         front = (front + 1) % MAX_SIZE;
         count--;
         return true;
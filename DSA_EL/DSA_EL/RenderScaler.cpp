@@ -0,0 +1,102 @@
+#include "RenderScaler.hpp"
+#include "Profiler.hpp"
+#include "MemoryTracker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+RenderScaler::RenderScaler(Window& window)
+    : m_window(window),
+      m_view(sf::FloatRect({ 0.f, 0.f }, window.getVirtualSize())),
+      m_scale(0.f),
+      m_maxScale(std::clamp(window.settings().renderScale, MIN_SCALE, 1.f)),
+      m_ready(true),
+      m_sampleMs(0.f),
+      m_samples(0)
+{
+    setScale(m_maxScale);
+}
+
+void RenderScaler::setScale(float scale) {
+    scale = std::clamp(scale, MIN_SCALE, m_maxScale);
+    if (!m_ready || scale == m_scale)
+        return;
+
+    sf::Vector2f virtualSize = m_window.getVirtualSize();
+    sf::Vector2u size(static_cast<unsigned int>(std::lround(virtualSize.x * scale)),
+                      static_cast<unsigned int>(std::lround(virtualSize.y * scale)));
+
+    MemoryScope memScope(MemTag::Resources);
+    if (!m_canvas.resize(size)) {
+        std::cerr << "[RenderScaler] RenderTexture unavailable, rendering at window resolution\n";
+        m_ready = false;
+        m_scale = 1.f;
+        return;
+    }
+    m_canvas.setSmooth(true);      // Bilinear upscale when the canvas is smaller than the window
+    m_scale = scale;
+
+    std::cout << "[GAME] Render scale " << static_cast<int>(std::lround(m_scale * 100.f)) << "%: "
+              << size.x << "x" << size.y << "\n";
+}
+
+sf::RenderTarget& RenderScaler::begin() {
+    if (!m_ready) {
+        sf::RenderWindow& native = m_window.native();
+        native.setView(m_window.view());
+        return native;
+    }
+
+    m_canvas.setView(m_view);
+    return m_canvas;
+}
+
+const sf::View& RenderScaler::view() const {
+    return m_ready ? m_view : m_window.view();
+}
+
+void RenderScaler::present() {
+    Profiler::getInstance().count(PerfCounter::RenderScale, static_cast<int>(std::lround(m_scale * 100.f)));
+    if (!m_ready)
+        return;
+
+    m_canvas.display();
+
+    sf::RenderWindow& native = m_window.native();
+    native.clear(sf::Color::Black);         // Letterbox bars
+    native.setView(m_window.view());
+
+    // Canvas pixels back to virtual units, then the window view fits them to the screen
+    sf::Sprite sprite(m_canvas.getTexture());
+    sprite.setScale({ 1.f / m_scale, 1.f / m_scale });
+    native.draw(sprite);
+}
+
+// Budget follows the frame cap; vsync and uncapped runs aim for 60 FPS
+float RenderScaler::budgetMs() const {
+    const WindowSettings& settings = m_window.settings();
+    unsigned int fps = (!settings.vsync && settings.framerateLimit > 0) ? settings.framerateLimit : 60;
+    return 1000.f / fps;
+}
+
+// Averages SAMPLE_FRAMES frames per decision; the gap between the two
+// thresholds keeps the scale from oscillating around the budget
+void RenderScaler::adapt(float workMs) {
+    if (!m_ready || !m_window.settings().dynamicScale)
+        return;
+
+    m_sampleMs += workMs;
+    if (++m_samples < SAMPLE_FRAMES)
+        return;
+
+    float averageMs = m_sampleMs / m_samples;
+    m_sampleMs = 0.f;
+    m_samples = 0;
+
+    float budget = budgetMs();
+    if (averageMs > budget * 0.9f && m_scale > MIN_SCALE)
+        setScale(m_scale - SCALE_STEP);
+    else if (averageMs < budget * 0.6f && m_scale < m_maxScale)
+        setScale(m_scale + SCALE_STEP);
+}
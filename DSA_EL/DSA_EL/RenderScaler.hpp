@@ -0,0 +1,47 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "Window.hpp"
+
+// ================= RENDER SCALER =================
+// Virtual-resolution rendering. Scenes draw in virtual units into an
+// offscreen canvas of (virtual size * scale) pixels; present() stretches
+// the canvas into the window's letterboxed view. In dynamic mode the
+// scale steps down when the frame's work overruns the budget and back up
+// when there is headroom, so fill-rate-bound machines (software GL) trade
+// sharpness for a steady frame rate. Without render-texture support it
+// draws straight to the window at native resolution.
+class RenderScaler {
+public:
+    static constexpr float MIN_SCALE = 0.5f;
+    static constexpr float SCALE_STEP = 0.1f;
+    static constexpr int SAMPLE_FRAMES = 30;        // Frames averaged per decision
+
+    explicit RenderScaler(Window& window);
+
+    // Target for this frame's scene rendering, with view() already applied
+    sf::RenderTarget& begin();
+
+    // Virtual-unit view on the current target (full canvas, or the window letterbox)
+    const sf::View& view() const;
+
+    // Resolves the canvas into the window; the caller draws overlays and displays
+    void present();
+
+    // Dynamic mode: feed the frame's work time (update + render + present, no vsync wait)
+    void adapt(float workMs);
+
+    void setScale(float scale);
+    float getScale() const { return m_scale; }
+
+private:
+    float budgetMs() const;
+
+    Window& m_window;
+    sf::RenderTexture m_canvas;
+    sf::View m_view;
+    float m_scale;
+    float m_maxScale;               // The configured scale; dynamic mode never exceeds it
+    bool m_ready;                   // Canvas available
+    float m_sampleMs;
+    int m_samples;
+};
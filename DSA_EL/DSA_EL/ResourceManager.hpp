@@ -3,6 +3,8 @@
 #include <unordered_map>
 #include <string>
 #include <iostream>
+#include <fstream>
+#include "MemoryTracker.hpp"
 
 class ResourceManager
 {
@@ -16,6 +18,7 @@ public:
     // Load and cache a texture
     sf::Texture* getTexture(const std::string& path)
     {
+        MemoryScope scope(MemTag::Resources);
         auto it = m_textures.find(path);
         if (it != m_textures.end())
             return &it->second;
@@ -34,6 +37,7 @@ public:
     // Load and cache a font
     sf::Font* getFont(const std::string& path)
     {
+        MemoryScope scope(MemTag::Resources);
         auto it = m_fonts.find(path);
         if (it != m_fonts.end())
             return &it->second;
@@ -49,6 +53,28 @@ public:
         return &m_fonts[path];
     }
 
+    // UI font: the first system font found (Windows, common Linux distros, macOS)
+    sf::Font* getDefaultFont()
+    {
+        static const char* candidates[] = {
+            "C:/Windows/Fonts/arial.ttf",
+            "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+            "/usr/share/fonts/TTF/DejaVuSans.ttf",
+            "/usr/share/fonts/dejavu-sans-fonts/DejaVuSans.ttf",
+            "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+            "/System/Library/Fonts/Supplemental/Arial.ttf"
+        };
+
+        for (const char* path : candidates)
+        {
+            if (std::ifstream(path).good())
+                return getFont(path);
+        }
+
+        std::cerr << "[ResourceManager] No system font found, text will not be drawn\n";
+        return nullptr;
+    }
+
     // Check if texture exists
     bool hasTexture(const std::string& path) const
     {
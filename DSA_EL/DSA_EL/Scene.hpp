@@ -0,0 +1,233 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "Stack.hpp"
+#include "Queue.hpp"
+#include "Window.hpp"
+#include <algorithm>
+#include <memory>
+#include <iostream>
+
+class SceneStack;
+
+// ================= SCENE =================
+// One screen of the application (menu, a game, an overlay). Scenes live on
+// the SceneStack and share the application Window; only the top scene
+// receives events. Scenes draw in virtual units: screen-space passes use
+// m_stack.screenView(), world passes a Camera.
+//
+// Threading: update() runs on the simulation thread while render() draws
+// the previous frame on the main thread, so the two must not share state.
+// update() writes a render snapshot (see DoubleBuffer) and never touches
+// the window, input or UI nodes; render() reads only that snapshot and
+// the UI. sync() runs on the main thread between frames, with the
+// simulation idle: publish the snapshot, sample input, react to events
+// the last update() raised (e.g. push a result overlay).
+class Scene
+{
+public:
+    explicit Scene(SceneStack& stack) : m_stack(stack) {}
+    virtual ~Scene() = default;
+
+    virtual void enter() {}         // Pushed onto the stack
+    virtual void exit() {}          // Popped off the stack
+    virtual void suspend() {}       // Another scene was pushed on top
+    virtual void resume() {}        // Back on top after the scene above popped
+
+    virtual void handleEvent(const sf::Event&) {}
+    virtual void sync() {}
+    virtual void update(float dt) = 0;
+    virtual void render(sf::RenderTarget& target) = 0;
+
+    // Overlays opt in to keeping the scene underneath alive
+    virtual bool updatesBelow() const { return false; }
+    virtual bool rendersBelow() const { return false; }
+
+    // False when the scene only changes in response to input; lets the main
+    // loop sleep in waitEvent() instead of redrawing identical frames
+    virtual bool isAnimating() const { return true; }
+
+    // Frame-metrics tags; a null mode inherits the mode of the scene below
+    virtual const char* mode() const { return nullptr; }
+    virtual const char* name() const = 0;
+
+protected:
+    SceneStack& m_stack;
+};
+
+// ================= SCENE STACK =================
+// Pushdown automaton over Stack<unique_ptr<Scene>>. push/pop/clear are
+// queued and applied between frames, so a scene can replace itself from
+// inside its own update() or a button callback.
+class SceneStack
+{
+public:
+    static constexpr int MAX_SCENES = 8;
+
+    SceneStack(Window& window, sf::Font* font) : m_window(window), m_font(font) {}
+
+    ~SceneStack()
+    {
+        while (!m_scenes.empty())
+            popNow();
+    }
+
+    SceneStack(const SceneStack&) = delete;
+    SceneStack& operator=(const SceneStack&) = delete;
+
+    // False (and logged) when MAX_SCENES * 2 changes are already queued this frame
+    bool push(std::unique_ptr<Scene> scene) { return request({ Action::Push, std::move(scene) }); }
+    bool pop() { return request({ Action::Pop, nullptr }); }
+    bool clear() { return request({ Action::Clear, nullptr }); }
+
+    // Returns true if the stack changed (the next frame must be drawn)
+    bool applyPending()
+    {
+        bool changed = false;
+        Change change;
+        while (m_pending.pop(change))
+        {
+            changed = true;
+            if (change.action == Action::Push)
+            {
+                if (Scene* below = top())
+                    below->suspend();
+
+                Scene* scene = change.scene.get();
+                if (!m_scenes.push(std::move(change.scene)))
+                {
+                    std::cerr << "[SceneStack] Stack full, scene dropped\n";
+                    if (Scene* below = top())
+                        below->resume();
+                    continue;
+                }
+                scene->enter();
+                std::cout << "[DSA] Stack: Pushed " << scene->name() << " scene (depth " << m_scenes.size() << ")\n";
+            }
+            else if (change.action == Action::Pop)
+            {
+                popNow();
+                if (Scene* scene = top())
+                {
+                    scene->resume();
+                    std::cout << "[DSA] Stack: Popped back to " << scene->name() << " (depth " << m_scenes.size() << ")\n";
+                }
+            }
+            else
+            {
+                while (!m_scenes.empty())
+                    popNow();
+            }
+        }
+        return changed;
+    }
+
+    void handleEvent(const sf::Event& event)
+    {
+        if (Scene* scene = top())
+            scene->handleEvent(event);
+    }
+
+    // Main thread, simulation idle; same scenes as update()
+    void sync()
+    {
+        for (int i = firstActive(&Scene::updatesBelow); i < m_scenes.size(); ++i)
+            m_scenes[i]->sync();
+    }
+
+    // Updates the top scene plus every scene an overlay lets through, bottom first
+    void update(float dt)
+    {
+        for (int i = firstActive(&Scene::updatesBelow); i < m_scenes.size(); ++i)
+            m_scenes[i]->update(dt);
+    }
+
+    // Draws from the lowest visible scene upwards so overlays land on top.
+    // `screenView` maps virtual units onto `target`; each scene starts with it.
+    void render(sf::RenderTarget& target, const sf::View& screenView)
+    {
+        m_screenView = screenView;
+        for (int i = firstActive(&Scene::rendersBelow); i < m_scenes.size(); ++i)
+        {
+            target.setView(m_screenView);
+            m_scenes[i]->render(target);
+        }
+    }
+
+    // Nothing that gets updated is animating: frames stay identical until an event
+    bool isIdle() const
+    {
+        for (int i = firstActive(&Scene::updatesBelow); i < m_scenes.size(); ++i)
+            if (m_scenes[i]->isAnimating())
+                return false;
+        return true;
+    }
+
+    Scene* top()
+    {
+        std::unique_ptr<Scene>* scene = m_scenes.peek();
+        return scene ? scene->get() : nullptr;
+    }
+
+    bool empty() const { return m_scenes.empty(); }
+    int size() const { return m_scenes.size(); }
+
+    // Metrics tags for the current frame
+    const char* mode() const
+    {
+        for (int i = m_scenes.size() - 1; i >= 0; --i)
+            if (const char* mode = m_scenes[i]->mode())
+                return mode;
+        return "none";
+    }
+
+    const char* state() const
+    {
+        const std::unique_ptr<Scene>* scene = m_scenes.peek();
+        return scene ? (*scene)->name() : "none";
+    }
+
+    Window& window() { return m_window; }
+    sf::Font* font() { return m_font; }
+
+    // Virtual-unit screen view of the target being rendered
+    const sf::View& screenView() const { return m_screenView; }
+
+private:
+    enum class Action { Push, Pop, Clear };
+
+    struct Change
+    {
+        Action action = Action::Pop;
+        std::unique_ptr<Scene> scene;
+    };
+
+    bool request(Change change)
+    {
+        if (m_pending.push(std::move(change)))
+            return true;
+        std::cerr << "[SceneStack] Pending queue full, change dropped\n";
+        return false;
+    }
+
+    void popNow()
+    {
+        std::unique_ptr<Scene> scene;
+        if (m_scenes.pop(scene))
+            scene->exit();
+    }
+
+    // Lowest index reached by walking down while each scene lets the one below through
+    int firstActive(bool (Scene::*passesBelow)() const) const
+    {
+        int i = m_scenes.size() - 1;
+        while (i > 0 && (m_scenes[i].get()->*passesBelow)())
+            --i;
+        return std::max(i, 0);
+    }
+
+    Window& m_window;
+    sf::Font* m_font;
+    sf::View m_screenView;
+    Stack<std::unique_ptr<Scene>, MAX_SCENES> m_scenes;
+    Queue<Change, MAX_SCENES * 2> m_pending;
+};
@@ -1,12 +1,385 @@
 #pragma once
+#include <SFML/Graphics.hpp>
+#include <algorithm>
 #include <vector>
 
+// ================= LAYOUT TYPES =================
+// Where a node sits inside its parent's box when the parent lays it out.
+// None keeps the position set by hand; layout never moves such a node.
+enum class Anchor { None, TopLeft, Top, TopRight, Left, Center, Right, BottomLeft, Bottom, BottomRight };
+
+// Space around a node (margin) or inside a container (padding)
+struct Insets {
+    float left = 0.f;
+    float top = 0.f;
+    float right = 0.f;
+    float bottom = 0.f;
+
+    static Insets all(float value) { return { value, value, value, value }; }
+    float horizontal() const { return left + right; }
+    float vertical() const { return top + bottom; }
+};
+
+// ================= SCENE NODE =================
+// UI tree with local transforms. World transforms and bounds are cached and
+// recomputed lazily: moving a node marks its subtree's transforms dirty and
+// its ancestors' subtree bounds dirty, and nothing else. A single draw()
+// traversal from the root sorts children by z-order, culls subtrees outside
+// the view and submits each node with its world transform.
 struct SceneNode {
     SceneNode* parent = nullptr;
     std::vector<SceneNode*> children;
 
+    virtual ~SceneNode() = default;
+
     void addChild(SceneNode* child) {
         child->parent = this;
         children.push_back(child);
+        child->markTransformDirty();
+        m_orderDirty = true;
+        markLayoutDirty();
+    }
+
+    void removeChild(SceneNode* child) {
+        auto it = std::find(children.begin(), children.end(), child);
+        if (it == children.end())
+            return;
+        children.erase(it);
+        child->parent = nullptr;
+        child->markTransformDirty();
+        markBoundsDirty();
+        markLayoutDirty();
+    }
+
+    // ---------------- Local transform ----------------
+    void setPosition(sf::Vector2f position) { m_local.setPosition(position); markTransformDirty(); }
+    void move(sf::Vector2f offset) { m_local.move(offset); markTransformDirty(); }
+    void setScale(sf::Vector2f scale) { m_local.setScale(scale); markTransformDirty(); }
+    void setRotation(sf::Angle angle) { m_local.setRotation(angle); markTransformDirty(); }
+    void setOrigin(sf::Vector2f origin) { m_local.setOrigin(origin); markTransformDirty(); }
+
+    sf::Vector2f getPosition() const { return m_local.getPosition(); }
+    const sf::Transform& getLocalTransform() const { return m_local.getTransform(); }
+
+    // Parent world transform * local transform, recomputed only when dirty
+    const sf::Transform& getWorldTransform() {
+        if (m_transformDirty) {
+            m_world = parent ? parent->getWorldTransform() * m_local.getTransform() : m_local.getTransform();
+            m_transformDirty = false;
+        }
+        return m_world;
+    }
+
+    // ---------------- Draw order and visibility ----------------
+    void setZOrder(int z) {
+        m_zOrder = z;
+        if (parent)
+            parent->m_orderDirty = true;
+    }
+
+    int getZOrder() const { return m_zOrder; }
+
+    void setVisible(bool visible) {
+        m_visible = visible;
+        markBoundsDirty();
+        markLayoutDirty();
+    }
+
+    bool isVisible() const { return m_visible; }
+
+    // ---------------- Bounds ----------------
+    // Content bounds in local space; empty for pure grouping nodes. Nodes
+    // that draw must report them, or culling skips their content.
+    virtual sf::FloatRect getLocalBounds() const { return {}; }
+
+    // This node's content in world space (cached)
+    const sf::FloatRect& getBounds() {
+        refreshBounds();
+        return m_bounds;
+    }
+
+    // Union of the visible subtree in world space, used for culling and hit-test rejection
+    const sf::FloatRect& getSubtreeBounds() {
+        refreshBounds();
+        return m_subtreeBounds;
+    }
+
+    // ---------------- Layout ----------------
+    // Two cached passes: measure() reports the size a node wants, arrange()
+    // places it in the slot its parent hands out. Both only re-run after a
+    // content change (markLayoutDirty) or when the slot itself changes.
+    void setAnchor(Anchor anchor) { m_anchor = anchor; markLayoutDirty(); }
+    Anchor getAnchor() const { return m_anchor; }
+
+    void setMargin(const Insets& margin) { m_margin = margin; markLayoutDirty(); }
+    const Insets& getMargin() const { return m_margin; }
+
+    const sf::Vector2f& getDesiredSize() {
+        if (m_measureDirty) {
+            m_desiredSize = measure();
+            m_measureDirty = false;
+        }
+        return m_desiredSize;
     }
+
+    // Puts the node's content at `slot` (parent-local) and lays out its
+    // children. Returns false when the cached arrangement still holds.
+    bool arrange(const sf::FloatRect& slot) {
+        if (!m_layoutDirty && slot == m_slot)
+            return false;
+        m_slot = slot;
+        m_layoutDirty = false;
+        setPosition(slot.position - getLocalBounds().position);
+        arrangeChildren(slot.size);
+        return true;
+    }
+
+    // ---------------- Traversal ----------------
+    void draw(sf::RenderTarget& target) {
+        const sf::View& view = target.getView();
+        sf::FloatRect viewRect(view.getCenter() - view.getSize() / 2.f, view.getSize());
+        drawTree(target, viewRect);
+    }
+
+    // Topmost interactive node containing `point`. Children draw after their
+    // parent and in z-order, so they are tested first, last to first.
+    SceneNode* hitTest(sf::Vector2f point) {
+        if (!m_visible || !getSubtreeBounds().contains(point))
+            return nullptr;
+
+        sortChildren();
+        for (auto it = children.rbegin(); it != children.rend(); ++it) {
+            if (SceneNode* hit = (*it)->hitTest(point))
+                return hit;
+        }
+        return (isInteractive() && getBounds().contains(point)) ? this : nullptr;
+    }
+
+    // Mouse hooks, called by UIRoot
+    virtual bool isInteractive() const { return false; }
+    virtual void onMouseEnter() {}
+    virtual void onMouseLeave() {}
+    virtual void onMousePress() {}
+    virtual void onMouseRelease(bool inside) { (void)inside; }
+
+protected:
+    // Draws the node's own content; `states.transform` is its world transform
+    virtual void drawSelf(sf::RenderTarget& target, sf::RenderStates states) { (void)target; (void)states; }
+
+    // Call when getLocalBounds() changes (new text, resized shape)
+    void markBoundsDirty() {
+        for (SceneNode* node = this; node && !node->m_boundsDirty; node = node->parent)
+            node->m_boundsDirty = true;
+    }
+
+    // Call when the size the node wants changes. Every ancestor re-measures,
+    // but only nodes whose slot actually moves get re-arranged.
+    void markLayoutDirty() {
+        for (SceneNode* node = this; node; node = node->parent) {
+            node->m_measureDirty = true;
+            node->m_layoutDirty = true;
+        }
+    }
+
+    // Preferred size; content nodes report their bounds, containers override
+    virtual sf::Vector2f measure() { return getLocalBounds().size; }
+
+    // Default arrangement: anchored children are placed inside this node's
+    // content box (or the slot for pure groups); the rest stay where they are.
+    virtual void arrangeChildren(sf::Vector2f size) {
+        sf::FloatRect content = getLocalBounds();
+        sf::FloatRect box = isEmpty(content) ? sf::FloatRect({ 0.f, 0.f }, size) : content;
+
+        for (SceneNode* child : children) {
+            if (child->m_anchor == Anchor::None) {
+                child->arrangeInPlace();
+                continue;
+            }
+            const sf::Vector2f& childSize = child->getDesiredSize();
+            child->arrange({ anchoredPosition(child->m_anchor, box, childSize, child->m_margin), childSize });
+        }
+    }
+
+private:
+    // Dirty transforms cover whole subtrees, so an already-dirty node stops the walk
+    void markTransformDirty() {
+        if (!m_transformDirty) {
+            m_transformDirty = true;
+            for (SceneNode* child : children)
+                child->markTransformDirty();
+        }
+        markBoundsDirty();
+    }
+
+    void refreshBounds() {
+        if (!m_boundsDirty)
+            return;
+
+        // Nodes without content (groups) only contribute their children
+        sf::FloatRect local = getLocalBounds();
+        m_bounds = isEmpty(local) ? sf::FloatRect() : getWorldTransform().transformRect(local);
+
+        // Hidden children are refreshed too, so no dirty node hides under a clean parent
+        m_subtreeBounds = m_bounds;
+        for (SceneNode* child : children) {
+            const sf::FloatRect& childBounds = child->getSubtreeBounds();
+            if (child->m_visible)
+                m_subtreeBounds = unite(m_subtreeBounds, childBounds);
+        }
+        m_boundsDirty = false;
+    }
+
+    // Hand-placed nodes keep their position but still lay out their children
+    void arrangeInPlace() {
+        if (!m_layoutDirty)
+            return;
+        m_layoutDirty = false;
+        arrangeChildren(getDesiredSize());
+    }
+
+    static sf::Vector2f anchoredPosition(Anchor anchor, const sf::FloatRect& box, sf::Vector2f size, const Insets& margin) {
+        int cell = static_cast<int>(anchor) - 1;        // 3x3 grid, row-major from TopLeft
+        int column = cell % 3;
+        int row = cell / 3;
+
+        float x = column == 0 ? box.position.x + margin.left
+                : column == 1 ? box.position.x + (box.size.x - size.x + margin.left - margin.right) / 2.f
+                : box.position.x + box.size.x - size.x - margin.right;
+        float y = row == 0 ? box.position.y + margin.top
+                : row == 1 ? box.position.y + (box.size.y - size.y + margin.top - margin.bottom) / 2.f
+                : box.position.y + box.size.y - size.y - margin.bottom;
+        return { x, y };
+    }
+
+    void sortChildren() {
+        if (!m_orderDirty)
+            return;
+        std::stable_sort(children.begin(), children.end(),
+            [](const SceneNode* a, const SceneNode* b) { return a->m_zOrder < b->m_zOrder; });
+        m_orderDirty = false;
+    }
+
+    void drawTree(sf::RenderTarget& target, const sf::FloatRect& viewRect) {
+        if (!m_visible || !getSubtreeBounds().findIntersection(viewRect))
+            return;
+
+        drawSelf(target, sf::RenderStates(getWorldTransform()));
+
+        sortChildren();
+        for (SceneNode* child : children)
+            child->drawTree(target, viewRect);
+    }
+
+    static bool isEmpty(const sf::FloatRect& r) {
+        return r.size.x <= 0.f && r.size.y <= 0.f;
+    }
+
+    static sf::FloatRect unite(const sf::FloatRect& a, const sf::FloatRect& b) {
+        if (isEmpty(a))
+            return b;
+        if (isEmpty(b))
+            return a;
+        sf::Vector2f min(std::min(a.position.x, b.position.x), std::min(a.position.y, b.position.y));
+        sf::Vector2f max(std::max(a.position.x + a.size.x, b.position.x + b.size.x),
+                         std::max(a.position.y + a.size.y, b.position.y + b.size.y));
+        return { min, max - min };
+    }
+
+    sf::Transformable m_local;
+    sf::Transform m_world;
+    sf::FloatRect m_bounds;             // Own content, world space
+    sf::FloatRect m_subtreeBounds;      // Visible subtree, world space
+    sf::FloatRect m_slot;               // Last arranged slot, parent-local
+    sf::Vector2f m_desiredSize;
+    Insets m_margin;
+    Anchor m_anchor = Anchor::None;
+    int m_zOrder = 0;
+    bool m_visible = true;
+    bool m_transformDirty = true;
+    bool m_boundsDirty = true;
+    bool m_orderDirty = false;
+    bool m_measureDirty = true;
+    bool m_layoutDirty = true;
+};
+
+// ================= UI ROOT =================
+// Entry point for SFML mouse events: maps the pixel position once (through
+// the view the UI is shown with, e.g. the window's letterbox), tracks
+// the hovered node and captures the pressed one until release, so a click
+// only fires when press and release land on the same node.
+class UIRoot : public SceneNode {
+public:
+    // Lays the tree out over `size` (the UI view). Free on ordinary frames;
+    // returns true when anything moved, so cached UI layers should redraw.
+    bool layout(sf::Vector2f size) {
+        return arrange({ { 0.f, 0.f }, size });
+    }
+
+    // Returns true when any node changed state (cached UI layers should redraw)
+    bool handleEvent(const sf::Event& event, const sf::RenderTarget& target, const sf::View& view) {
+        if (auto* moved = event.getIf<sf::Event::MouseMoved>())
+            return updateHover(toUI(moved->position, target, view));
+
+        if (auto* pressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+            if (pressed->button != sf::Mouse::Button::Left)
+                return false;
+            bool changed = updateHover(toUI(pressed->position, target, view));
+            if (m_hovered) {
+                m_pressed = m_hovered;
+                m_pressed->onMousePress();
+                changed = true;
+            }
+            return changed;
+        }
+
+        if (auto* released = event.getIf<sf::Event::MouseButtonReleased>()) {
+            if (released->button != sf::Mouse::Button::Left)
+                return false;
+            bool changed = updateHover(toUI(released->position, target, view));
+            if (m_pressed) {
+                SceneNode* node = m_pressed;
+                m_pressed = nullptr;
+                node->onMouseRelease(node == m_hovered);
+                changed = true;
+            }
+            return changed;
+        }
+
+        if (event.is<sf::Event::MouseLeft>())
+            return updateHover(nullptr);
+
+        return false;
+    }
+
+    // Drops hover and capture, e.g. when another scene takes over input
+    void reset() {
+        if (m_pressed) {
+            m_pressed->onMouseRelease(false);
+            m_pressed = nullptr;
+        }
+        updateHover(nullptr);
+    }
+
+private:
+    static sf::Vector2f toUI(sf::Vector2i pixel, const sf::RenderTarget& target, const sf::View& view) {
+        return target.mapPixelToCoords(pixel, view);
+    }
+
+    bool updateHover(sf::Vector2f point) {
+        return updateHover(hitTest(point));
+    }
+
+    bool updateHover(SceneNode* hovered) {
+        if (hovered == m_hovered)
+            return false;
+        if (m_hovered)
+            m_hovered->onMouseLeave();
+        m_hovered = hovered;
+        if (m_hovered)
+            m_hovered->onMouseEnter();
+        return true;
+    }
+
+    SceneNode* m_hovered = nullptr;
+    SceneNode* m_pressed = nullptr;
 };
@@ -0,0 +1,112 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "DynamicArray.hpp"
+#include <algorithm>
+#include <cmath>
+
+// ================= SPATIAL GRID =================
+// Uniform-grid broad phase. Each item is listed in every cell its bounds
+// touch; bounds outside the grid are clamped to the border cells. Cell
+// arrays keep their capacity across clear(), so per-frame rebuilds stop
+// allocating once the scene has warmed up.
+class SpatialGrid
+{
+public:
+    SpatialGrid(sf::FloatRect area, float cellSize)
+        : m_origin(area.position), m_cellSize(cellSize),
+          m_cols(std::max(1, static_cast<int>(std::ceil(area.size.x / cellSize)))),
+          m_rows(std::max(1, static_cast<int>(std::ceil(area.size.y / cellSize)))),
+          m_queryStamp(0)
+    {
+        for (int i = 0; i < m_cols * m_rows; ++i)
+            m_cells.push_back(DynamicArray<int>());
+    }
+
+    void clear()
+    {
+        for (int i = 0; i < m_cells.size(); ++i)
+            m_cells[i].clear();
+        m_bounds.clear();
+        m_stamps.clear();
+    }
+
+    // Items are identified by insertion order (0, 1, 2...)
+    int insert(const sf::FloatRect& bounds)
+    {
+        int id = m_bounds.size();
+        m_bounds.push_back(bounds);
+        m_stamps.push_back(0);
+
+        int x0, y0, x1, y1;
+        cellRange(bounds, x0, y0, x1, y1);
+        for (int y = y0; y <= y1; ++y)
+            for (int x = x0; x <= x1; ++x)
+                m_cells[y * m_cols + x].push_back(id);
+        return id;
+    }
+
+    // Appends the id of every item whose bounds overlap `area` (no duplicates)
+    template<typename Alloc>
+    void query(const sf::FloatRect& area, DynamicArray<int, Alloc>& out)
+    {
+        // Stamp visited items so ones spanning several cells are reported once
+        m_queryStamp++;
+
+        int x0, y0, x1, y1;
+        cellRange(area, x0, y0, x1, y1);
+        for (int y = y0; y <= y1; ++y)
+        {
+            for (int x = x0; x <= x1; ++x)
+            {
+                const DynamicArray<int>& cell = m_cells[y * m_cols + x];
+                for (int i = 0; i < cell.size(); ++i)
+                {
+                    int id = cell[i];
+                    if (m_stamps[id] == m_queryStamp)
+                        continue;
+                    m_stamps[id] = m_queryStamp;
+                    if (overlaps(m_bounds[id], area))
+                        out.push_back(id);
+                }
+            }
+        }
+    }
+
+    int size() const { return m_bounds.size(); }
+    int cellCount() const { return m_cells.size(); }
+
+private:
+    static bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b)
+    {
+        return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+               a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+    }
+
+    int cellX(float x) const
+    {
+        return std::clamp(static_cast<int>(std::floor((x - m_origin.x) / m_cellSize)), 0, m_cols - 1);
+    }
+
+    int cellY(float y) const
+    {
+        return std::clamp(static_cast<int>(std::floor((y - m_origin.y) / m_cellSize)), 0, m_rows - 1);
+    }
+
+    void cellRange(const sf::FloatRect& r, int& x0, int& y0, int& x1, int& y1) const
+    {
+        x0 = cellX(r.position.x);
+        y0 = cellY(r.position.y);
+        x1 = cellX(r.position.x + r.size.x);
+        y1 = cellY(r.position.y + r.size.y);
+    }
+
+    sf::Vector2f m_origin;
+    float m_cellSize;
+    int m_cols;
+    int m_rows;
+
+    DynamicArray<DynamicArray<int>> m_cells;
+    DynamicArray<sf::FloatRect> m_bounds;
+    DynamicArray<unsigned> m_stamps;
+    unsigned m_queryStamp;
+};
@@ -1,11 +1,12 @@
 #pragma once
+#include <utility>
 
 template<typename T, int MAX_SIZE = 100>
 class Stack
 {
 public:
     // Initialize data array to zeros/default
-    Stack() : top(-1), data() {}
+    Stack() : data(), top(-1) {}
 
     bool push(const T& value)
     {
@@ -16,15 +17,45 @@ public:
         return true;
     }
 
+    // Move-only values (e.g. std::unique_ptr) go in by move
+    bool push(T&& value)
+    {
+        if (top >= MAX_SIZE - 1)
+            return false;   // stack overflow
+
+        data[++top] = std::move(value);
+        return true;
+    }
+
     bool pop(T& out)
     {
         if (top < 0)
             return false;   // stack underflow
 
-        out = data[top--];
+        out = std::move(data[top--]);
         return true;
     }
 
+    // Top element, or nullptr when empty
+    T* peek()
+    {
+        return top < 0 ? nullptr : &data[top];
+    }
+
+    const T* peek() const
+    {
+        return top < 0 ? nullptr : &data[top];
+    }
+
+    // i = 0 is the bottom of the stack
+    T& operator[](int i) { return data[i]; }
+    const T& operator[](int i) const { return data[i]; }
+
+    int size() const
+    {
+        return top + 1;
+    }
+
     bool empty() const
     {
         return top < 0;
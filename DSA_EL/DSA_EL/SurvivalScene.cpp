@@ -0,0 +1,190 @@
+#include "SurvivalScene.hpp"
+#include "OverlayScenes.hpp"
+#include "Profiler.hpp"
+#include <iostream>
+#include <cstdio>
+
+constexpr float WINDOW_WIDTH = 800.f;
+constexpr float WINDOW_HEIGHT = 600.f;
+
+// ---------------- Constructor ----------------
+SurvivalScene::SurvivalScene(SceneStack& stack)
+    : Scene(stack), m_font(stack.font()), m_world({ WINDOW_WIDTH, WINDOW_HEIGHT }), m_finished(false), m_roundOver(false)
+{
+    // Initialize HUD
+    m_hud = std::make_unique<HUD>(m_font);
+    m_ui.addChild(m_hud.get());
+
+    // Particle snapshots sized for the whole pool up front
+    for (int i = 0; i < 2; ++i)
+        m_frames[i].particles.reserve(m_world.getParticles().capacity());
+
+    // Initialize Grid (Visuals, world space)
+    sf::FloatRect arena = m_world.getArena();
+    m_grid.setPrimitiveType(sf::PrimitiveType::Lines);
+    for (float x = 0; x < arena.size.x; x += 50.f)
+    {
+        sf::Vertex v1; v1.position = sf::Vector2f(x, 0.f); v1.color = sf::Color(30, 30, 50); m_grid.append(v1);
+        sf::Vertex v2; v2.position = sf::Vector2f(x, arena.size.y); v2.color = sf::Color(30, 30, 50); m_grid.append(v2);
+    }
+    for (float y = 0; y < arena.size.y; y += 50.f)
+    {
+        sf::Vertex v1; v1.position = sf::Vector2f(0.f, y); v1.color = sf::Color(30, 30, 50); m_grid.append(v1);
+        sf::Vertex v2; v2.position = sf::Vector2f(arena.size.x, y); v2.color = sf::Color(30, 30, 50); m_grid.append(v2);
+    }
+}
+
+void SurvivalScene::enter()
+{
+    m_stack.window().setTitle("DSA Survival");
+
+    std::cout << ">>> SURVIVAL MODE STARTED <<<\n";
+    std::cout << "Goal: Collect " << SurvivalWorld::COLLECTIBLES_TO_WIN << " stars.\n";
+    std::cout << "[ECS] Registry: Player, enemy and stars as entities\n";
+    std::cout << "[DSA] DynamicArray: Contiguous component storage\n";
+    std::cout << "[DSA] Queue: Buffering player input (FIFO)\n";
+    std::cout << "[DSA] Stack: Scene stack (pause and game over are overlays)\n";
+    std::cout << "[DSA] LinkedList: Tracking score history\n";
+
+    // First frame on screen before the first update has run
+    writeFrame();
+    m_frames.swap();
+}
+
+void SurvivalScene::handleEvent(const sf::Event& event)
+{
+    if (auto* keyEvent = event.getIf<sf::Event::KeyPressed>())
+    {
+        if (keyEvent->code == sf::Keyboard::Key::Escape)
+            m_stack.push(std::make_unique<PauseScene>(m_stack));
+    }
+}
+
+// Between frames: publish the last update, then react to it or sample input for the next
+void SurvivalScene::sync()
+{
+    m_frames.swap();
+
+    if (m_roundOver)
+    {
+        m_roundOver = false;
+        finishRound();
+        return;
+    }
+
+    // Round over: the game-over overlay owns input until retry or menu
+    if (m_finished)
+        return;
+
+    // ---- INPUT HANDLING ----
+    sf::Vector2f move(0.f, 0.f);
+
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W)) move.y -= 1.f;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S)) move.y += 1.f;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A)) move.x -= 1.f;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D)) move.x += 1.f;
+
+    m_inputQueue.push({ move });  // [DSA] Queue: Push input command (main thread)
+}
+
+// Simulation thread: consumes input queued by sync() and writes the next frame
+void SurvivalScene::update(float dt)
+{
+    // Round over: only the particles keep playing under the result overlay
+    if (m_finished)
+    {
+        m_world.getParticles().update(dt);
+        writeFrame();
+        return;
+    }
+
+    PlayerInput input;
+    Command cmd;
+    while (!m_inputQueue.empty())
+        if (m_inputQueue.pop(cmd))  // [DSA] Queue: Pop and apply in FIFO order
+            input.move += cmd.move;
+
+    // ---- SIMULATION (ECS systems) ----
+    m_world.update(dt, input);
+    writeFrame();
+
+    if (m_world.isGameOver() || m_world.isWon())
+        m_roundOver = true;
+}
+
+// Copies what render() draws out of the world; called by update(), or
+// from the main thread while the simulation is idle
+void SurvivalScene::writeFrame()
+{
+    SurvivalFrame& frame = m_frames.back();
+    frame.drawList.clear();
+    m_world.submit(frame.drawList);
+    m_world.getParticles().submit(frame.particles);
+    frame.camera = m_world.getCamera();
+    frame.time = m_world.getSurvivalTime();
+    frame.collected = m_world.getCollected();
+    frame.enemies = m_world.getEnemyCount();
+}
+
+// Records the score and pushes the result overlay (once per round)
+void SurvivalScene::finishRound()
+{
+    m_finished = true;
+
+    DynamicArray<OverlayText> lines;
+    if (m_world.isWon())
+    {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "Time: %.2fs", m_world.getSurvivalTime());
+        lines.push_back({ "YOU WON!", 50, Colors::Success });
+        lines.push_back({ buffer, 30, Colors::Text });
+    }
+    else
+    {
+        // [DSA] LinkedList: Track score history
+        m_scoreHistory.push_front(m_world.getCollected());
+        std::cout << "[DSA] LinkedList: Score " << m_world.getCollected() << " added to history ("
+                  << m_scoreHistory.size() << " entries, pooled nodes)\n";
+
+        lines.push_back({ "GAME OVER", 50, Colors::Danger });
+    }
+
+    m_stack.push(std::make_unique<GameOverScene>(m_stack, std::move(lines), [this]() { restart(); }, true));
+}
+
+void SurvivalScene::restart()
+{
+    m_world.reset();
+    m_finished = false;
+    m_roundOver = false;
+    writeFrame();
+    m_frames.swap();
+}
+
+void SurvivalScene::render(sf::RenderTarget& target)
+{
+    // Main thread: draws the last published frame while update() builds the next
+    SurvivalFrame& frame = m_frames.front();
+
+    target.clear(Colors::Background);
+
+    // World pass through the camera
+    frame.camera.apply(target);
+
+    // Grid (Cached)
+    target.draw(m_grid);
+
+    // Entities (render submission from the ECS), then particles in one batch
+    frame.drawList.flush(target);
+    frame.particles.draw(target);
+
+    // Screen-space pass (HUD; overlays draw on top from the scene stack)
+    m_hud->update(frame.time, frame.collected);
+    target.setView(m_stack.screenView());
+    m_ui.layout(m_stack.screenView().getSize());
+    m_ui.draw(target);
+
+    Profiler& profiler = Profiler::getInstance();
+    profiler.count(PerfCounter::Particles, frame.particles.size());
+    profiler.count(PerfCounter::Obstacles, frame.enemies);
+}
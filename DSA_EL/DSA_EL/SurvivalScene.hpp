@@ -0,0 +1,74 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// Data structures
+#include "DynamicArray.hpp"
+#include "Queue.hpp"
+#include "LinkedList.hpp"
+
+// Engine systems
+#include "Scene.hpp"
+#include "Colors.hpp"
+#include "UI.hpp"
+#include "DrawList.hpp"
+#include "DoubleBuffer.hpp"
+#include "SurvivalWorld.hpp"
+
+struct Command
+{
+    sf::Vector2f move;      // Movement direction for this tick
+};
+
+// What render() needs from one simulated frame
+struct SurvivalFrame
+{
+    DrawList drawList;      // Entities, world space
+    ParticleBatch particles;
+    Camera camera;
+    float time = 0.f;
+    int collected = 0;
+    int enemies = 0;
+};
+
+// ================= GAME 1 (SURVIVAL) =================
+class SurvivalScene : public Scene
+{
+public:
+    explicit SurvivalScene(SceneStack& stack);
+
+    void enter() override;
+    void handleEvent(const sf::Event& event) override;
+    void sync() override;
+    void update(float dt) override;
+    void render(sf::RenderTarget& target) override;
+
+    bool isAnimating() const override { return !m_finished || m_world.getParticles().size() > 0; }
+    const char* mode() const override { return "survival"; }
+    const char* name() const override { return "Playing"; }
+
+private:
+    void restart();
+    void finishRound();
+    void writeFrame();
+
+private:
+    sf::Font* m_font;
+
+    // Simulation (player, enemy and stars live in the world's ECS registry)
+    SurvivalWorld m_world;
+    DoubleBuffer<SurvivalFrame> m_frames;        // update() fills back, render() draws front
+
+    // Data structures (DSA Demonstration)
+    Queue<Command> m_inputQueue;                 // FIFO input processing
+    LinkedList<int> m_scoreHistory;              // Score tracking linked list (slab-pooled nodes)
+
+    // UI (HUD anchored top-left; laid out only when its text changes)
+    UIRoot m_ui;
+    std::unique_ptr<HUD> m_hud;
+
+    // Background Grid (Cached for performance)
+    sf::VertexArray m_grid;
+
+    bool m_finished;                             // Game-over overlay already pushed
+    bool m_roundOver;                            // Set by update(); sync() pushes the overlay
+};
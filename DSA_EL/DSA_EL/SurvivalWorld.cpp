@@ -0,0 +1,204 @@
+#include "SurvivalWorld.hpp"
+#include "Systems.hpp"
+#include "Colors.hpp"
+#include "Effects.hpp"
+#include "MemoryTracker.hpp"
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+    constexpr float PLAYER_SPEED = 320.f;
+    constexpr float ENEMY_SPEED = 450.f;
+    constexpr float ARENA_WIDTH = 800.f;     // World size; may exceed the window
+    constexpr float ARENA_HEIGHT = 600.f;
+    constexpr float PLAYER_SIZE = 30.f;
+    constexpr float ENEMY_RADIUS = 25.f;
+    constexpr float COLLECTIBLE_SPAWN_INTERVAL = 2.5f;
+    constexpr int MAX_LIVE_COLLECTIBLES = 5;
+
+    // Random direction that avoids near-cardinal angles
+    sf::Vector2f randomEnemyVelocity()
+    {
+        float angle;
+        do {
+            angle = static_cast<float>((std::rand() % 360) * 3.14159 / 180.0);
+        } while (std::abs(std::cos(angle)) < 0.3f || std::abs(std::sin(angle)) < 0.3f);
+
+        return { std::cos(angle) * ENEMY_SPEED, std::sin(angle) * ENEMY_SPEED };
+    }
+
+    // 5-point star, shared by every collectible
+    const ShapeDesc& starShape()
+    {
+        static ShapeDesc star = [] {
+            sf::Vector2f pts[10];
+            for (int i = 0; i < 10; ++i)
+            {
+                float angle = static_cast<float>(i * 2 * 3.14159f / 10 - 3.14159f / 2);
+                float r = (i % 2 == 0) ? 12.f : 6.f; // Outer/Inner radius
+                pts[i] = { std::cos(angle) * r, std::sin(angle) * r };
+            }
+            ShapeDesc s = ShapeDesc::polygon(pts, 10, Colors::Warning);
+            s.outlineThickness = 2.f;
+            s.outline = sf::Color(255, 220, 100);
+            return s;
+        }();
+        return star;
+    }
+}
+
+// ---------------- Constructor ----------------
+SurvivalWorld::SurvivalWorld(sf::Vector2f viewSize, int particleBudget)
+    : m_player(NullEntity), m_enemy(NullEntity), m_particles(particleBudget), m_camera(viewSize),
+      m_gameOver(false), m_won(false), m_survivalTime(0.f), m_spawnTimer(0.f), m_collected(0)
+{
+    m_pickupFx = m_particles.addEmitter(Effects::pop(Colors::Warning, 10));
+    m_winFx = m_particles.addEmitter(Effects::pop(Colors::Success, 50));
+    m_hitFx = m_particles.addEmitter(Effects::pop(Colors::Danger, 30));
+
+    // Camera is clamped to the arena, so it only moves once the arena outgrows the window
+    m_camera.setBounds(getArena());
+    reset();
+}
+
+// ---------------- Reset ----------------
+void SurvivalWorld::reset()
+{
+    MemoryScope scope(MemTag::World);
+    m_registry.clear();
+    m_particles.clear();
+    m_gameOver = false;
+    m_won = false;
+    m_survivalTime = 0.f;
+    m_spawnTimer = 0.f;
+    m_collected = 0;
+
+    sf::FloatRect arena = getArena();
+
+    // Player (Square)
+    m_player = m_registry.create();
+    m_registry.add<PlayerTag>(m_player);
+    m_registry.add<Transform>(m_player).position = { ARENA_WIDTH / 2.f, ARENA_HEIGHT / 2.f };
+    m_registry.add<Velocity>(m_player);
+    m_registry.add<Collider>(m_player, Collider::box({ 0.f, 0.f }, { PLAYER_SIZE, PLAYER_SIZE }));
+    m_registry.add<Bounded>(m_player, Bounded{ arena, { PLAYER_SIZE, PLAYER_SIZE }, false });
+
+    Renderable& pr = m_registry.add<Renderable>(m_player);
+    pr.shape = ShapeDesc::rectangle({ PLAYER_SIZE, PLAYER_SIZE }, Colors::Player);
+    pr.shape.outlineThickness = 3.f;
+    pr.shape.outline = sf::Color(100, 255, 200);
+    pr.glow = Glow{ true, sf::Color(100, 200, 255, 50), 5.f, 1.f };
+
+    // Enemy (bouncing circle)
+    m_enemy = m_registry.create();
+    m_registry.add<EnemyTag>(m_enemy);
+    m_registry.add<Transform>(m_enemy).position = { 100.f, 100.f };
+    m_registry.add<Velocity>(m_enemy).value = randomEnemyVelocity();
+    m_registry.add<Collider>(m_enemy, Collider::circle({ ENEMY_RADIUS, ENEMY_RADIUS }, ENEMY_RADIUS));
+    m_registry.add<Bounded>(m_enemy, Bounded{ arena, { ENEMY_RADIUS * 2.f, ENEMY_RADIUS * 2.f }, true });
+
+    Renderable& er = m_registry.add<Renderable>(m_enemy);
+    er.shape = ShapeDesc::circle(ENEMY_RADIUS, Colors::Enemy);
+    er.shape.outlineThickness = 3.f;
+    er.shape.outline = sf::Color(255, 100, 100);
+    er.glow = Glow{ true, sf::Color(255, 50, 50, 50), 5.f, 1.f };
+
+    m_camera.follow({ ARENA_WIDTH / 2.f, ARENA_HEIGHT / 2.f }, m_camera.getSize() / 2.f);
+}
+
+// ---------------- Collectible Spawning ----------------
+void SurvivalWorld::spawnCollectible()
+{
+    float x = static_cast<float>(std::rand() % (int)(ARENA_WIDTH - 40.f)) + 20.f;
+    float y = static_cast<float>(std::rand() % (int)(ARENA_HEIGHT - 40.f)) + 20.f;
+    spawnCollectibleAt({ x, y });
+}
+
+void SurvivalWorld::spawnCollectibleAt(sf::Vector2f position)
+{
+    Entity star = m_registry.create();
+    m_registry.add<CollectibleTag>(star);
+    m_registry.add<Transform>(star).position = position;
+    m_registry.add<Collider>(star, Collider::box({ -12.f, -12.f }, { 24.f, 24.f }));
+
+    Renderable& r = m_registry.add<Renderable>(star);
+    r.shape = starShape();
+    r.glow = Glow{ true, sf::Color(255, 220, 100, 50), 0.f, 1.2f };
+}
+
+// ---------------- Update ----------------
+void SurvivalWorld::update(float dt, const PlayerInput& input)
+{
+    MemoryScope scope(MemTag::World);
+
+    if (m_gameOver || m_won)
+        return;
+
+    m_survivalTime += dt;
+
+    // ---- INPUT -> VELOCITY ----
+    m_registry.get<Velocity>(m_player).value = input.move * PLAYER_SPEED;
+
+    // ---- MOVEMENT / BOUNDS ----
+    Systems::movement(m_registry, dt);
+    Systems::bounds(m_registry);
+    Systems::lifetime(m_registry, dt);
+
+    Transform& playerT = m_registry.get<Transform>(m_player);
+    sf::Vector2f playerCenter = playerT.position + sf::Vector2f(PLAYER_SIZE / 2.f, PLAYER_SIZE / 2.f);
+
+    // Keep the player centred on screen where the arena allows it
+    m_camera.follow(playerCenter, m_camera.getSize() / 2.f);
+
+    // ---- SPAWN COLLECTIBLES ----
+    m_spawnTimer += dt;
+    if (m_spawnTimer >= COLLECTIBLE_SPAWN_INTERVAL &&
+        m_registry.pool<CollectibleTag>().size() < MAX_LIVE_COLLECTIBLES)
+    {
+        m_spawnTimer = 0.f;
+        spawnCollectible();
+    }
+
+    // ---- COLLECT ITEMS ----
+    Systems::collide<PlayerTag, CollectibleTag>(m_registry, [&](Entity, Entity star) {
+        m_registry.destroyLater(star);
+        m_collected++;
+        m_particles.burst(m_pickupFx, playerCenter);
+
+        std::cout << "[GAME] Collected! Total: " << m_collected << "/" << COLLECTIBLES_TO_WIN << "\n";
+        std::cout << "[ECS] Live entities: " << m_registry.aliveCount() - 1 << "\n";
+
+        if (m_collected >= COLLECTIBLES_TO_WIN && !m_won)
+        {
+            m_won = true;
+            m_particles.burst(m_winFx, m_camera.screenToWorld(m_camera.getSize() / 2.f));
+            std::cout << ">>> YOU WON! Time: " << m_survivalTime << "s <<<\n";
+        }
+    });
+    m_registry.flushDestroyed();
+
+    // ---- ENEMY HIT ----
+    Systems::collide<PlayerTag, EnemyTag>(m_registry, [&](Entity, Entity) {
+        if (m_gameOver)
+            return;
+        m_gameOver = true;
+        m_registry.get<Renderable>(m_player).visible = false;
+        m_particles.burst(m_hitFx, playerCenter);
+        std::cout << ">>> GAME OVER! Time: " << m_survivalTime << "s <<<\n";
+    });
+
+    m_particles.update(dt);
+}
+
+sf::FloatRect SurvivalWorld::getArena() const
+{
+    return sf::FloatRect({ 0.f, 0.f }, { ARENA_WIDTH, ARENA_HEIGHT });
+}
+
+// ---------------- Render Submission ----------------
+void SurvivalWorld::submit(DrawList& list)
+{
+    Systems::render(m_registry, list, m_camera.getVisibleArea());
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "ECS.hpp"
+#include "Components.hpp"
+#include "DrawList.hpp"
+#include "Camera.hpp"
+#include "Particles.hpp"
+#include "InputManager.hpp"
+
+// ================= SURVIVAL SIMULATION =================
+// Entity state for the Survival arena, stored in an ECS registry.
+// No window or UI here, so the world can be stepped headless.
+class SurvivalWorld
+{
+public:
+    static constexpr int COLLECTIBLES_TO_WIN = 10;
+    static constexpr int PARTICLE_BUDGET = 1024;
+
+    SurvivalWorld(sf::Vector2f viewSize, int particleBudget = PARTICLE_BUDGET);
+
+    void reset();
+    void update(float dt, const PlayerInput& input);
+    void submit(DrawList& list);
+
+    // Places a star at a fixed spot (scripted scenarios and benchmarks)
+    void spawnCollectibleAt(sf::Vector2f position);
+
+    bool isGameOver() const { return m_gameOver; }
+    bool isWon() const { return m_won; }
+    float getSurvivalTime() const { return m_survivalTime; }
+    int getCollected() const { return m_collected; }
+    int getEnemyCount() { return m_registry.pool<EnemyTag>().size(); }
+    sf::FloatRect getArena() const;
+
+    Camera& getCamera() { return m_camera; }
+    ParticleSystem& getParticles() { return m_particles; }
+    const ParticleSystem& getParticles() const { return m_particles; }
+    Registry& getRegistry() { return m_registry; }
+
+private:
+    void spawnCollectible();
+
+    Registry m_registry;
+    Entity m_player;
+    Entity m_enemy;
+
+    ParticleSystem m_particles;
+    int m_pickupFx;         // Emitter ids
+    int m_winFx;
+    int m_hitFx;
+    Camera m_camera;
+
+    bool m_gameOver;
+    bool m_won;
+    float m_survivalTime;
+    float m_spawnTimer;
+    int m_collected;
+};
@@ -0,0 +1,131 @@
+#pragma once
+#include "ECS.hpp"
+#include "Components.hpp"
+#include "Collision.hpp"
+#include "DrawList.hpp"
+#include "FrameArena.hpp"
+#include "MemoryTracker.hpp"
+#include "Profiler.hpp"
+
+// ================= SYSTEMS =================
+// Each system is one tight loop over contiguous component arrays.
+namespace Systems
+{
+    inline void gravity(Registry& registry, float dt)
+    {
+        registry.view<Gravity, Velocity>().each([dt](Entity, Gravity& g, Velocity& v) {
+            v.value.y += g.strength * dt;
+        });
+    }
+
+    inline void movement(Registry& registry, float dt)
+    {
+        registry.view<Velocity, Transform>().each([dt](Entity, Velocity& v, Transform& t) {
+            t.position += v.value * dt;
+        });
+    }
+
+    // Clamp to (or bounce off) the Bounded area
+    inline void bounds(Registry& registry)
+    {
+        registry.view<Bounded, Transform>().each([&registry](Entity e, Bounded& b, Transform& t) {
+            float left = b.area.position.x;
+            float top = b.area.position.y;
+            float right = left + b.area.size.x;
+            float bottom = top + b.area.size.y;
+
+            if (b.bounce)
+            {
+                Velocity* v = registry.tryGet<Velocity>(e);
+                if (!v) return;
+                if (t.position.x <= left || t.position.x + b.extent.x >= right)
+                    v->value.x *= -1;
+                if (t.position.y <= top || t.position.y + b.extent.y >= bottom)
+                    v->value.y *= -1;
+            }
+            else
+            {
+                t.position.x = std::clamp(t.position.x, left, right - b.extent.x);
+                t.position.y = std::clamp(t.position.y, top, bottom - b.extent.y);
+            }
+        });
+    }
+
+    // Count down lifetimes and destroy expired entities
+    inline void lifetime(Registry& registry, float dt)
+    {
+        registry.view<Lifetime>().each([&registry, dt](Entity e, Lifetime& l) {
+            l.remaining -= dt;
+            if (l.remaining <= 0.f)
+                registry.destroyLater(e);
+        });
+        registry.flushDestroyed();
+    }
+
+    // Calls fn(a, b) for every overlapping pair of an A-tagged and a B-tagged entity
+    template<typename TagA, typename TagB, typename Fn>
+    void collide(Registry& registry, Fn fn)
+    {
+        MemoryScope scope(MemTag::Collision);
+        ProfileScope profile(ProfileSection::Collision);
+
+        // Resolve B's world colliders once into frame scratch memory
+        DynamicArray<Entity, ArenaArrayAllocator> others;
+        DynamicArray<Collision::WorldCollider, ArenaArrayAllocator> otherColliders;
+        registry.view<TagB, Transform, Collider>().each([&](Entity b, TagB&, Transform& tb, Collider& cb) {
+            others.push_back(b);
+            otherColliders.push_back(Collision::toWorld(tb, cb));
+        });
+
+        registry.view<TagA, Transform, Collider>().each([&](Entity a, TagA&, Transform& ta, Collider& ca) {
+            Collision::WorldCollider wa = Collision::toWorld(ta, ca);
+            for (int i = 0; i < others.size(); ++i)
+            {
+                if (Collision::overlaps(wa, otherColliders[i]))
+                    fn(a, others[i]);
+            }
+        });
+    }
+
+    // Submit visible renderables (and their glow) to the draw list
+    inline void render(Registry& registry, DrawList& list, const sf::FloatRect& visibleArea)
+    {
+        registry.view<Renderable, Transform>().each([&](Entity, Renderable& r, Transform& t) {
+            if (!r.visible)
+                return;
+
+            // Cull against the camera using the shape's extent
+            float ext = r.shape.extent() * std::max(t.scale.x, t.scale.y) + r.glow.padding;
+            if (t.position.x + ext < visibleArea.position.x ||
+                t.position.x - ext > visibleArea.position.x + visibleArea.size.x ||
+                t.position.y + ext < visibleArea.position.y ||
+                t.position.y - ext > visibleArea.position.y + visibleArea.size.y)
+                return;
+
+            if (r.glow.enabled)
+            {
+                ShapeDesc glow = r.shape;
+                glow.fill = r.glow.color;
+                glow.outlineThickness = 0.f;
+                sf::Vector2f scale = t.scale;
+                if (glow.kind == ShapeKind::Rectangle)
+                {
+                    glow.size += sf::Vector2f(r.glow.padding * 2.f, r.glow.padding * 2.f);
+                    glow.origin += sf::Vector2f(r.glow.padding, r.glow.padding);
+                }
+                else if (glow.kind == ShapeKind::Circle)
+                {
+                    glow.radius += r.glow.padding;
+                    glow.origin += sf::Vector2f(r.glow.padding, r.glow.padding);
+                }
+                else
+                {
+                    scale *= r.glow.scale;
+                }
+                list.submit(glow, t.position, t.rotation, scale, r.layer);
+            }
+
+            list.submit(r.shape, t.position, t.rotation, t.scale, r.layer);
+        });
+    }
+}
@@ -0,0 +1,149 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ================= THREAD POOL =================
+// Fixed set of worker threads for data-parallel loops. parallelFor(count, job)
+// calls job(index) once for every index in [0, count) and returns when all
+// have finished; the calling thread takes indices too, so a pool of N
+// threads starts N - 1 workers. Indices are handed out one at a time from
+// an atomic counter, so uneven items balance themselves. Everything the
+// jobs wrote is visible to the caller once parallelFor returns.
+//
+// One loop runs at a time: a parallelFor issued while another is running
+// (from a second thread, or from inside a job) runs serially on its caller.
+class ThreadPool
+{
+public:
+    // threads counts the caller; 0 means one per hardware thread
+    explicit ThreadPool(int threads = 0)
+    {
+        if (threads <= 0)
+            threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+        for (int i = 1; i < threads; ++i)
+            m_workers.emplace_back([this]() { loop(); });
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_quit = true;
+        }
+        m_wake.notify_all();
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Shared pool sized to the machine (particles and other per-frame loops)
+    static ThreadPool& getInstance()
+    {
+        static ThreadPool instance;
+        return instance;
+    }
+
+    int threadCount() const
+    {
+        return static_cast<int>(m_workers.size()) + 1;
+    }
+
+    template<typename Job>
+    void parallelFor(int count, const Job& job)
+    {
+        if (count <= 0)
+            return;
+
+        bool idle = false;
+        if (count == 1 || m_workers.empty() || !m_busy.compare_exchange_strong(idle, true))
+        {
+            for (int i = 0; i < count; ++i)
+                job(i);
+            return;
+        }
+
+        // Type-erased without std::function, so a loop never allocates
+        auto call = [](const void* context, int index) { (*static_cast<const Job*>(context))(index); };
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_call = call;
+            m_context = &job;
+            m_count = count;
+            m_next.store(0, std::memory_order_relaxed);
+            m_running = static_cast<int>(m_workers.size());
+            m_generation++;
+        }
+        m_wake.notify_all();
+
+        runIndices(call, &job, count);
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this]() { return m_running == 0; });
+        }
+        m_busy.store(false);
+    }
+
+private:
+    using Call = void (*)(const void*, int);
+
+    void runIndices(Call call, const void* context, int count)
+    {
+        for (int i = m_next.fetch_add(1, std::memory_order_relaxed); i < count;
+             i = m_next.fetch_add(1, std::memory_order_relaxed))
+            call(context, i);
+    }
+
+    // Every worker joins every loop (possibly finding no indices left), so
+    // none can miss a generation: the next loop waits for all of them
+    void loop()
+    {
+        unsigned int seen = 0;
+        for (;;)
+        {
+            Call call;
+            const void* context;
+            int count;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&]() { return m_quit || m_generation != seen; });
+                if (m_quit)
+                    return;
+                seen = m_generation;
+                call = m_call;
+                context = m_context;
+                count = m_count;
+            }
+
+            runIndices(call, context, count);
+
+            bool last;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                last = --m_running == 0;
+            }
+            if (last)
+                m_done.notify_one();
+        }
+    }
+
+    std::atomic<bool> m_busy{ false };      // A loop is in flight
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    Call m_call = nullptr;
+    const void* m_context = nullptr;
+    int m_count = 0;
+    std::atomic<int> m_next{ 0 };
+    int m_running = 0;              // Workers still inside the current loop
+    unsigned int m_generation = 0;
+    bool m_quit = false;
+    std::vector<std::thread> m_workers;     // Last: start after the members they use
+};
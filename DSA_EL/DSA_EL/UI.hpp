@@ -1,24 +1,29 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "Colors.hpp"
-#include "SceneNode.hpp"
+#include "Layout.hpp"
+#include "MemoryTracker.hpp"
 #include <string>
 #include <functional>
 #include <memory>
+#include <cmath>
+#include <cstdio>
 
 // ==================== BUTTON ====================
+// Shape and label live in local space; the node's world transform places
+// them (set by hand with setPosition, or by a parent layout).
 class Button : public SceneNode
 {
 public:
-    Button(sf::Vector2f size, sf::Vector2f position, const std::string& label, sf::Font* font = nullptr)
-        : m_label(label), m_font(font), m_isHovered(false), m_isPressed(false), m_text(nullptr)
+    Button(sf::Vector2f size, const std::string& label, sf::Font* font = nullptr)
+        : m_text(nullptr), m_label(label), m_font(font), m_isHovered(false), m_isPressed(false)
     {
         m_shape.setSize(size);
-        m_shape.setPosition(position);
         m_shape.setFillColor(Colors::ButtonNormal);
         m_shape.setOutlineThickness(2.f);
         m_shape.setOutlineColor(Colors::Accent);
 
+        MemoryScope scope(MemTag::UI);
         if (m_font)
         {
             m_text = std::make_unique<sf::Text>(*m_font, label, 20);
@@ -32,56 +37,67 @@ public:
         m_callback = callback;
     }
 
-    void update(const sf::RenderWindow& window)
+    sf::FloatRect getLocalBounds() const override { return m_shape.getGlobalBounds(); }
+
+    // Driven by UIRoot events; fires the callback on a release that follows a press on this button
+    bool isInteractive() const override { return true; }
+
+    void onMouseEnter() override
     {
-        sf::Vector2f mouse = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-        m_isHovered = m_shape.getGlobalBounds().contains(mouse);
+        m_isHovered = true;
+        refreshColor();
+    }
 
-        if (m_isHovered)
-        {
-            m_shape.setFillColor(Colors::ButtonHover);
-            if (sf::Mouse::isButtonPressed(sf::Mouse::Button::Left))
-            {
-                m_shape.setFillColor(Colors::ButtonPressed);
-                if (!m_isPressed)
-                {
-                    m_isPressed = true;
-                }
-            }
-            else if (m_isPressed)
-            {
-                // Button was released while hovered - trigger callback
-                m_isPressed = false;
-                if (m_callback)
-                    m_callback();
-            }
-        }
-        else
-        {
-            m_shape.setFillColor(Colors::ButtonNormal);
-            m_isPressed = false;
-        }
+    void onMouseLeave() override
+    {
+        m_isHovered = false;
+        refreshColor();
     }
 
-    void draw(sf::RenderWindow& window)
+    void onMousePress() override
     {
-        window.draw(m_shape);
-        if (m_text)
-            window.draw(*m_text);
+        m_isPressed = true;
+        refreshColor();
+    }
+
+    void onMouseRelease(bool inside) override
+    {
+        m_isPressed = false;
+        refreshColor();
+        if (inside && m_callback)
+            m_callback();
     }
 
     bool isHovered() const { return m_isHovered; }
-    sf::RectangleShape& getShape() { return m_shape; }
+
+protected:
+    void drawSelf(sf::RenderTarget& target, sf::RenderStates states) override
+    {
+        target.draw(m_shape, states);
+        if (m_text)
+            target.draw(*m_text, states);
+    }
 
 private:
+    void refreshColor()
+    {
+        if (m_isHovered && m_isPressed)
+            m_shape.setFillColor(Colors::ButtonPressed);
+        else if (m_isHovered)
+            m_shape.setFillColor(Colors::ButtonHover);
+        else
+            m_shape.setFillColor(Colors::ButtonNormal);
+    }
+
+    // Centred once in local space; moving the button never touches the text
     void centerText()
     {
         if (!m_text) return;
         sf::FloatRect textBounds = m_text->getLocalBounds();
-        sf::FloatRect shapeBounds = m_shape.getGlobalBounds();
+        sf::Vector2f size = m_shape.getSize();
         m_text->setPosition({
-            shapeBounds.position.x + (shapeBounds.size.x - textBounds.size.x) / 2.f - textBounds.position.x,
-            shapeBounds.position.y + (shapeBounds.size.y - textBounds.size.y) / 2.f - textBounds.position.y
+            (size.x - textBounds.size.x) / 2.f - textBounds.position.x,
+            (size.y - textBounds.size.y) / 2.f - textBounds.position.y
         });
     }
 
@@ -98,19 +114,28 @@ private:
 class Panel : public SceneNode
 {
 public:
-    Panel(sf::Vector2f size, sf::Vector2f position, sf::Color color = Colors::PanelBackground)
+    Panel(sf::Vector2f size, sf::Vector2f position = {}, sf::Color color = Colors::PanelBackground)
     {
         m_shape.setSize(size);
-        m_shape.setPosition(position);
         m_shape.setFillColor(color);
+        setPosition(position);
     }
 
-    void draw(sf::RenderWindow& window)
+    void setOutline(float thickness, sf::Color color)
     {
-        window.draw(m_shape);
+        m_shape.setOutlineThickness(thickness);
+        m_shape.setOutlineColor(color);
+        markBoundsDirty();
+        markLayoutDirty();
     }
 
-    sf::RectangleShape& getShape() { return m_shape; }
+    sf::FloatRect getLocalBounds() const override { return m_shape.getGlobalBounds(); }
+
+protected:
+    void drawSelf(sf::RenderTarget& target, sf::RenderStates states) override
+    {
+        target.draw(m_shape, states);
+    }
 
 private:
     sf::RectangleShape m_shape;
@@ -120,21 +145,28 @@ private:
 class Label : public SceneNode
 {
 public:
-    Label(const std::string& text, sf::Font* font, unsigned int size, sf::Vector2f position)
-        : m_font(font), m_text(nullptr), m_position(position)
+    Label(const std::string& text, sf::Font* font, unsigned int size, sf::Vector2f position = {})
+        : m_text(nullptr), m_font(font)
     {
+        setPosition(position);
+
+        MemoryScope scope(MemTag::UI);
         if (m_font)
         {
             m_text = std::make_unique<sf::Text>(*m_font, text, size);
-            m_text->setPosition(position);
             m_text->setFillColor(Colors::Text);
         }
     }
 
     void setText(const std::string& text)
     {
+        MemoryScope scope(MemTag::UI);
         if (m_text)
+        {
             m_text->setString(text);
+            markBoundsDirty();
+            markLayoutDirty();
+        }
     }
 
     void setColor(sf::Color color)
@@ -143,85 +175,73 @@ public:
             m_text->setFillColor(color);
     }
 
-    void centerHorizontally(float windowWidth)
+    sf::FloatRect getLocalBounds() const override
     {
-        if (!m_text) return;
-        sf::FloatRect bounds = m_text->getLocalBounds();
-        m_text->setPosition({
-            (windowWidth - bounds.size.x) / 2.f - bounds.position.x,
-            m_text->getPosition().y
-        });
+        return m_text ? m_text->getGlobalBounds() : sf::FloatRect();
     }
 
-    void draw(sf::RenderWindow& window)
+protected:
+    void drawSelf(sf::RenderTarget& target, sf::RenderStates states) override
     {
         if (m_text)
-            window.draw(*m_text);
+            target.draw(*m_text, states);
     }
 
-    sf::Text* getText() { return m_text.get(); }
-
 private:
     std::unique_ptr<sf::Text> m_text;
     sf::Font* m_font;
-    sf::Vector2f m_position;
 };
 
 // ==================== HUD ====================
-class HUD
+// Left-aligned stack of two labels, anchored top-left by default. Strings
+// are only rebuilt when the displayed value changes (score, or time at
+// 0.1s resolution), so the stack re-measures a few times per second at most.
+class HUD : public StackLayout
 {
 public:
-    HUD(sf::Font* font) : m_font(font), m_score(0), m_time(0.f),
-        m_scoreText(nullptr), m_timeText(nullptr)
+    HUD(sf::Font* font)
+        : StackLayout(Orientation::Vertical, 8.f, Align::Start),
+          m_scoreLabel("Score: 0", font, 18),
+          m_timeLabel("Time: 0.0s", font, 18),
+          m_score(0), m_tenths(0)
     {
-        if (m_font)
-        {
-            m_scoreText = std::make_unique<sf::Text>(*m_font, "Score: 0", 18);
-            m_scoreText->setPosition({ 10.f, 10.f });
-            m_scoreText->setFillColor(Colors::Text);
-
-            m_timeText = std::make_unique<sf::Text>(*m_font, "Time: 0.0s", 18);
-            m_timeText->setPosition({ 10.f, 35.f });
-            m_timeText->setFillColor(Colors::TextDim);
-        }
+        m_timeLabel.setColor(Colors::TextDim);
+        addChild(&m_scoreLabel);
+        addChild(&m_timeLabel);
+        setAnchor(Anchor::TopLeft);
+        setMargin(Insets::all(10.f));
     }
 
     void setScore(int score)
     {
+        if (score == m_score)
+            return;
         m_score = score;
-        if (m_scoreText)
-            m_scoreText->setString("Score: " + std::to_string(m_score));
+        m_scoreLabel.setText("Score: " + std::to_string(m_score));
     }
 
     void setTime(float time)
     {
-        m_time = time;
-        if (m_timeText)
-        {
-            char buf[32];
-            snprintf(buf, sizeof(buf), "Time: %.1fs", m_time);
-            m_timeText->setString(buf);
-        }
+        int tenths = static_cast<int>(std::lround(time * 10.f));
+        if (tenths == m_tenths)
+            return;
+        m_tenths = tenths;
+
+        char buf[32];
+        snprintf(buf, sizeof(buf), "Time: %.1fs", m_tenths / 10.f);
+        m_timeLabel.setText(buf);
     }
 
     void update(float time, int score)
     {
+        MemoryScope scope(MemTag::UI);
         setTime(time);
         setScore(score);
     }
 
-    void draw(sf::RenderWindow& window)
-    {
-        if (m_scoreText)
-            window.draw(*m_scoreText);
-        if (m_timeText)
-            window.draw(*m_timeText);
-    }
-
 private:
-    sf::Font* m_font;
-    std::unique_ptr<sf::Text> m_scoreText;
-    std::unique_ptr<sf::Text> m_timeText;
+    Label m_scoreLabel;
+    Label m_timeLabel;
     int m_score;
-    float m_time;
+    int m_tenths;
 };
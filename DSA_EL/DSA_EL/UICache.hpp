@@ -0,0 +1,56 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "MemoryTracker.hpp"
+#include <iostream>
+
+// ==================== UI CACHE ====================
+// Retained layer for static screens (menus, pause and result overlays).
+// The content is drawn into a RenderTexture only after invalidate(); every
+// other frame composites it with a single sprite draw. Falls back to
+// drawing directly when render textures are unavailable.
+class UICache
+{
+public:
+    explicit UICache(sf::Vector2u size)
+    {
+        MemoryScope scope(MemTag::UI);
+        m_ready = m_texture.resize(size);
+        if (m_ready)
+            m_texture.setSmooth(true);
+        else
+            std::cerr << "[UICache] RenderTexture unavailable, drawing UI directly\n";
+    }
+
+    void invalidate() { m_dirty = true; }
+    bool isDirty() const { return m_dirty; }
+
+    // drawContent(sf::RenderTarget&) issues the layer's draws; it only runs when dirty
+    template<typename DrawFn>
+    void draw(sf::RenderTarget& target, DrawFn&& drawContent)
+    {
+        if (!m_ready)
+        {
+            drawContent(target);
+            return;
+        }
+
+        if (m_dirty)
+        {
+            m_texture.clear(sf::Color::Transparent);
+            drawContent(m_texture);
+            m_texture.display();
+            m_dirty = false;
+        }
+
+        // Alpha-blending into a transparent target leaves premultiplied colour
+        sf::Sprite sprite(m_texture.getTexture());
+        target.draw(sprite, sf::RenderStates(PREMULTIPLIED));
+    }
+
+private:
+    static inline const sf::BlendMode PREMULTIPLIED{ sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha };
+
+    sf::RenderTexture m_texture;
+    bool m_ready = false;
+    bool m_dirty = true;
+};
@@ -1,30 +1,137 @@
 #include "Window.hpp"
+#include <iostream>
 
-Window::Window()
-    : m_window(sf::VideoMode({ 800, 600 }), "SFML 3 Engine")
+Window::Window(const WindowSettings& settings)
+    : m_settings(settings)
 {
+    create();
 }
 
+void Window::create() {
+    sf::ContextSettings context;
+    context.antiAliasingLevel = m_settings.antialiasing;
+
+    m_window.create(sf::VideoMode({ m_settings.width, m_settings.height }), m_settings.title,
+                    sf::Style::Default, sf::State::Windowed, context);
+    applySync();
+    updateView();
+
+    std::cout << "[GAME] Window: " << m_settings.width << "x" << m_settings.height << " (virtual "
+              << m_settings.virtualWidth << "x" << m_settings.virtualHeight << "), ";
+    if (m_settings.vsync)
+        std::cout << "vsync\n";
+    else if (m_settings.framerateLimit > 0)
+        std::cout << m_settings.framerateLimit << " fps cap\n";
+    else
+        std::cout << "uncapped\n";
+}
+
+void Window::applySync() {
+    m_window.setVerticalSyncEnabled(m_settings.vsync);
+    m_window.setFramerateLimit(m_settings.vsync ? 0 : m_settings.framerateLimit);
+}
+
+// Fits the virtual area to the window, centred, with bars on the longer axis
+void Window::updateView() {
+    sf::Vector2f virtualSize = getVirtualSize();
+    sf::Vector2u size = m_window.getSize();
+    m_view = sf::View(sf::FloatRect({ 0.f, 0.f }, virtualSize));
+    if (size.x == 0 || size.y == 0)
+        return;
+
+    float windowRatio = static_cast<float>(size.x) / size.y;
+    float virtualRatio = virtualSize.x / virtualSize.y;
+    sf::FloatRect viewport({ 0.f, 0.f }, { 1.f, 1.f });
+    if (windowRatio > virtualRatio) {
+        viewport.size.x = virtualRatio / windowRatio;
+        viewport.position.x = (1.f - viewport.size.x) / 2.f;
+    } else {
+        viewport.size.y = windowRatio / virtualRatio;
+        viewport.position.y = (1.f - viewport.size.y) / 2.f;
+    }
+    m_view.setViewport(viewport);
+}
+
+void Window::apply(const WindowSettings& settings) {
+    bool recreate = settings.width != m_settings.width || settings.height != m_settings.height ||
+                    settings.antialiasing != m_settings.antialiasing;
+    bool virtualChanged = settings.virtualWidth != m_settings.virtualWidth ||
+                          settings.virtualHeight != m_settings.virtualHeight;
+    m_settings = settings;
+
+    if (recreate) {
+        create();
+        return;
+    }
+
+    if (virtualChanged)
+        updateView();
+    m_window.setTitle(m_settings.title);
+    applySync();
+}
+
+const WindowSettings& Window::settings() const {
+    return m_settings;
+}
+
+void Window::setTitle(const std::string& title) {
+    m_settings.title = title;
+    m_window.setTitle(title);
+}
+
+void Window::setVSync(bool enabled) {
+    m_settings.vsync = enabled;
+    applySync();
+}
+
+void Window::setFramerateLimit(unsigned int limit) {
+    m_settings.framerateLimit = limit;
+    applySync();
+}
 
 bool Window::isOpen() const {
     return m_window.isOpen();
 }
 
-void Window::pollEvents() {
-    while (auto event = m_window.pollEvent()) {
-        if (event->is<sf::Event::Closed>())
-            m_window.close();
-    }
+void Window::close() {
+    m_window.close();
+}
+
+// Resizes are seen here first so the letterbox is current before any scene maps the mouse
+std::optional<sf::Event> Window::pollEvent() {
+    std::optional<sf::Event> event = m_window.pollEvent();
+    if (event && event->is<sf::Event::Resized>())
+        updateView();
+    return event;
 }
 
-void Window::clear() {
-    m_window.clear();
+std::optional<sf::Event> Window::waitEvent(sf::Time timeout) {
+    std::optional<sf::Event> event = m_window.waitEvent(timeout);
+    if (event && event->is<sf::Event::Resized>())
+        updateView();
+    return event;
+}
+
+void Window::clear(sf::Color color) {
+    m_window.clear(color);
 }
 
 void Window::display() {
     m_window.display();
 }
 
+sf::Vector2u Window::getSize() const {
+    return m_window.getSize();
+}
+
+sf::Vector2f Window::getVirtualSize() const {
+    return { static_cast<float>(m_settings.virtualWidth), static_cast<float>(m_settings.virtualHeight) };
+}
+
 sf::RenderWindow& Window::native() {
     return m_window;
 }
+
+const sf::View& Window::view() const {
+    return m_view;
+}
@@ -1,17 +1,63 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <optional>
+#include <string>
 
+// ================= WINDOW SETTINGS =================
+// Every display option in one place. vsync and the framerate cap are
+// exclusive (SFML advises against combining them): vsync wins when set.
+// Scenes work in virtual units; the window can be any size and shows the
+// virtual area letterboxed to its aspect ratio.
+struct WindowSettings
+{
+    unsigned int width = 800;               // Window size in pixels
+    unsigned int height = 600;
+    unsigned int virtualWidth = 800;        // Logical resolution every scene draws in
+    unsigned int virtualHeight = 600;
+    std::string title = "DSA Game Engine";
+    bool vsync = false;
+    unsigned int framerateLimit = 60;      // 0 = uncapped
+    unsigned int antialiasing = 0;         // MSAA samples
+    float renderScale = 1.f;               // Offscreen resolution = virtual size * scale
+    bool dynamicScale = false;             // Lower/raise the scale to hold the frame budget
+};
+
+// ================= WINDOW =================
+// The application's only OS window and GL context. Created once in main()
+// and handed to every mode, so switching modes never tears the context
+// down (textures and fonts in ResourceManager stay valid).
 class Window {
 public:
-    Window();
-    bool isOpen() const;
+    explicit Window(const WindowSettings& settings = WindowSettings());
+
+    // Applies new settings; only a size or antialiasing change recreates the window
+    void apply(const WindowSettings& settings);
+    const WindowSettings& settings() const;
 
-    void pollEvents();
-    void clear();
+    void setTitle(const std::string& title);
+    void setVSync(bool enabled);
+    void setFramerateLimit(unsigned int limit);
+
+    bool isOpen() const;
+    void close();
+    std::optional<sf::Event> pollEvent();
+    std::optional<sf::Event> waitEvent(sf::Time timeout = sf::Time::Zero);   // Zero = until input arrives
+    void clear(sf::Color color = sf::Color::Black);
     void display();
 
+    sf::Vector2u getSize() const;
+    sf::Vector2f getVirtualSize() const;
     sf::RenderWindow& native();
 
+    // Virtual area letterboxed into the window; also maps mouse pixels to virtual units
+    const sf::View& view() const;
+
 private:
+    void create();
+    void applySync();
+    void updateView();
+
+    WindowSettings m_settings;
     sf::RenderWindow m_window;
+    sf::View m_view;
 };
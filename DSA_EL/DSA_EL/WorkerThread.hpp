@@ -0,0 +1,82 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// ================= WORKER THREAD =================
+// One long-lived thread that runs a single job at a time. run() hands the
+// job over and returns at once; wait() blocks until it has finished. The
+// mutex hand-off also orders memory: everything the job wrote is visible
+// to the caller once wait() returns.
+class WorkerThread
+{
+public:
+    WorkerThread()
+    {
+        m_thread = std::thread([this]() { loop(); });
+    }
+
+    ~WorkerThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_quit = true;
+        }
+        m_wake.notify_one();
+        m_thread.join();
+    }
+
+    WorkerThread(const WorkerThread&) = delete;
+    WorkerThread& operator=(const WorkerThread&) = delete;
+
+    // Call wait() before handing over the next job
+    void run(std::function<void()> job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_job = std::move(job);
+            m_busy = true;
+        }
+        m_wake.notify_one();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return !m_busy; });
+    }
+
+private:
+    void loop()
+    {
+        for (;;)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this]() { return m_quit || m_job; });
+                if (!m_job)
+                    return;
+                job = std::move(m_job);
+                m_job = nullptr;
+            }
+
+            job();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_busy = false;
+            }
+            m_done.notify_one();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::function<void()> m_job;
+    bool m_busy = false;
+    bool m_quit = false;
+    std::thread m_thread;       // Last: starts after the members it uses
+};
@@ -0,0 +1,67 @@
+// ---------------- LinearArena / FrameArena ----------------
+#include "TestCommon.hpp"
+#include "FrameArena.hpp"
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+TEST(LinearArena_BumpAlignAndReset)
+{
+    LinearArena arena(4096);
+    CHECK(arena.capacity() == 4096);
+
+    unsigned char* a = static_cast<unsigned char*>(arena.allocate(3, 1));
+    unsigned char* b = static_cast<unsigned char*>(arena.allocate(8, 8));
+    CHECK(reinterpret_cast<std::uintptr_t>(b) % 8 == 0);
+    CHECK(b - a == 8);                  // Padded up to the alignment, nothing more
+    CHECK(arena.used() == 16);
+
+    arena.reset();
+    CHECK(arena.used() == 0);
+    CHECK(arena.highWater() == 16);
+    CHECK(arena.allocate(1, 1) == a);   // Rewound to the start of the same buffer
+}
+
+TEST(LinearArena_OverflowFallsBackToHeapAndGrowsAtReset)
+{
+    LinearArena arena(4096);
+    void* inBuffer = arena.allocate(4000, 16);
+    void* spilled = arena.allocate(1000, 64);
+    std::memset(inBuffer, 0xAB, 4000);
+    std::memset(spilled, 0xCD, 1000);   // Sanitizer builds catch a short chunk
+
+    CHECK(reinterpret_cast<std::uintptr_t>(spilled) % 64 == 0);
+    CHECK(arena.capacity() == 4096);    // Overflow never moves memory already handed out
+    CHECK(arena.used() == 4000 + 1000 + 64);
+
+    // The next frame fits the peak (rounded to 4 KB) without overflowing
+    arena.reset();
+    CHECK(arena.used() == 0);
+    CHECK(arena.highWater() == 5064);
+    CHECK(arena.capacity() == 8192);
+    arena.allocate(5000, 16);
+    CHECK(arena.used() == 5000);
+}
+
+TEST(FrameArena_PreviousFrameSurvivesOneFlip)
+{
+    FrameArena& frames = FrameArena::getInstance();
+    frames.endFrame();
+    frames.endFrame();                  // Both arenas wiped, whatever ran before
+    CHECK(frames.current().used() == 0);
+    CHECK(frames.previous().used() == 0);
+
+    int* value = new (frames.allocate(sizeof(int), alignof(int))) int(42);
+    CHECK(frames.current().used() == sizeof(int));
+
+    frames.endFrame();
+    CHECK(frames.lastFrameBytes() == sizeof(int));
+    CHECK(frames.peakFrameBytes() >= sizeof(int));
+    CHECK(frames.previous().used() == sizeof(int));
+    CHECK(frames.current().used() == 0);
+    CHECK(*value == 42);                // Still readable for one more frame
+
+    frames.endFrame();                  // Its arena comes round again and is wiped
+    CHECK(frames.current().used() == 0);
+    CHECK(frames.allocate(sizeof(int), alignof(int)) == value);
+}
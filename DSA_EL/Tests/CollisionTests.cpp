@@ -0,0 +1,76 @@
+// ---------------- Swept AABB / SAT ----------------
+#include "TestCommon.hpp"
+#include "Collision.hpp"
+
+TEST(SweepAabb_HitsThinTargetInOneStep)
+{
+    // A 10 px box moving 200 px must not tunnel through a 2 px wall
+    sf::FloatRect mover({ 0.f, 0.f }, { 10.f, 10.f });
+    sf::FloatRect wall({ 100.f, -50.f }, { 2.f, 100.f });
+    Collision::SweepHit hit;
+
+    CHECK(Collision::sweepAabb(mover, { 200.f, 0.f }, wall, hit));
+    CHECK_NEAR(hit.time, 90.f / 200.f, 1e-6f);
+    CHECK_NEAR(hit.exitTime, 102.f / 200.f, 1e-6f);
+    CHECK(hit.normal.x == -1.f && hit.normal.y == 0.f);
+}
+
+TEST(SweepAabb_NormalFollowsLaterAxis)
+{
+    // Falling onto a top face: y closes last, so the normal points up
+    sf::FloatRect mover({ 0.f, 0.f }, { 10.f, 10.f });
+    sf::FloatRect floor({ -100.f, 20.f }, { 300.f, 10.f });
+    Collision::SweepHit hit;
+
+    CHECK(Collision::sweepAabb(mover, { 5.f, 20.f }, floor, hit));
+    CHECK_NEAR(hit.time, 0.5f, 1e-6f);
+    CHECK(hit.normal.x == 0.f && hit.normal.y == -1.f);
+}
+
+TEST(SweepAabb_MissesAndOverlapAtStart)
+{
+    sf::FloatRect mover({ 0.f, 0.f }, { 10.f, 10.f });
+    Collision::SweepHit hit;
+
+    // Too short, moving away, and parallel but offset
+    CHECK(!Collision::sweepAabb(mover, { 50.f, 0.f }, { { 100.f, 0.f }, { 10.f, 10.f } }, hit));
+    CHECK(!Collision::sweepAabb(mover, { -50.f, 0.f }, { { 20.f, 0.f }, { 10.f, 10.f } }, hit));
+    CHECK(!Collision::sweepAabb(mover, { 50.f, 0.f }, { { 20.f, 10.f }, { 10.f, 10.f } }, hit));
+
+    // Touching edges are not a hit; overlap at the start is time 0, no normal
+    CHECK(!Collision::sweepAabb(mover, { 0.f, 5.f }, { { 10.f, 0.f }, { 10.f, 10.f } }, hit));
+    CHECK(Collision::sweepAabb(mover, { 1.f, 0.f }, { { 5.f, 5.f }, { 10.f, 10.f } }, hit));
+    CHECK(hit.time == 0.f);
+    CHECK(hit.normal.x == 0.f && hit.normal.y == 0.f);
+}
+
+TEST(HullOverlap_TriangleAgainstRotatedSquare)
+{
+    const sf::Vector2f spikePoints[3] = { { 0.f, 0.f }, { 20.f, -40.f }, { 40.f, 0.f } };
+    Hull spike = Hull::polygon(spikePoints, 3);
+    Hull square = Hull::box({ -10.f, -10.f }, { 20.f, 20.f });
+
+    Transform spikePose;
+    spikePose.position = { 0.f, 0.f };
+    Collision::WorldHull spikeHull = Collision::toWorld(spikePose, spike);
+
+    // Square beside the tip: the boxes overlap but the slanted edge separates
+    Transform pose;
+    pose.position = { 42.f, -30.f };
+    CHECK(Collision::aabbOverlap(spikeHull.bounds, Collision::toWorld(pose, square).bounds));
+    CHECK(!Collision::hullOverlap(spikeHull, Collision::toWorld(pose, square)));
+
+    // Rotated 45 degrees its corner reaches down onto the slope
+    pose.position = { 34.f, -20.f };
+    pose.rotation = 45.f;
+    CHECK(Collision::hullOverlap(spikeHull, Collision::toWorld(pose, square)));
+
+    // Straddling the tip
+    pose.position = { 20.f, -40.f };
+    pose.rotation = 0.f;
+    CHECK(Collision::hullOverlap(spikeHull, Collision::toWorld(pose, square)));
+
+    // Far away: rejected by bounds
+    pose.position = { 500.f, 500.f };
+    CHECK(!Collision::hullOverlap(spikeHull, Collision::toWorld(pose, square)));
+}
@@ -0,0 +1,128 @@
+// ---------------- DynamicArray / LinkedList / PoolAllocator ----------------
+#include "TestCommon.hpp"
+#include "DynamicArray.hpp"
+#include "LinkedList.hpp"
+#include "PoolAllocator.hpp"
+#include <cstdint>
+#include <string>
+
+TEST(DynamicArray_PushGrowAndIndex)
+{
+    DynamicArray<int> a;
+    for (int i = 0; i < 1000; ++i)
+        a.push_back(i * 3);
+
+    CHECK(a.size() == 1000);
+    bool ordered = true;
+    for (int i = 0; i < a.size(); ++i)
+        ordered = ordered && a[i] == i * 3;
+    CHECK(ordered);
+    CHECK(a.back() == 999 * 3);
+}
+
+TEST(DynamicArray_PushBackOwnElementWhileGrowing)
+{
+    DynamicArray<std::string> a;
+    a.push_back("first");
+    a.push_back("second");      // Fills the initial capacity of 2
+    a.push_back(a[0]);          // Source lives in the buffer being reallocated
+    CHECK(a.size() == 3);
+    CHECK(a[2] == "first");
+}
+
+TEST(DynamicArray_CopyAndMove)
+{
+    DynamicArray<std::string> a;
+    a.push_back("x");
+    a.push_back("y");
+
+    DynamicArray<std::string> copy(a);
+    copy[0] = "changed";
+    CHECK(a[0] == "x");
+    CHECK(copy.size() == 2);
+
+    DynamicArray<std::string> moved(std::move(copy));
+    CHECK(moved.size() == 2);
+    CHECK(moved[0] == "changed");
+    CHECK(copy.size() == 0);
+}
+
+TEST(DynamicArray_ResizeEraseFrontTruncate)
+{
+    DynamicArray<int> a;
+    a.resize(5);
+    bool zeroed = true;
+    for (int i = 0; i < a.size(); ++i)
+        zeroed = zeroed && a[i] == 0;
+    CHECK(a.size() == 5);
+    CHECK(zeroed);
+
+    for (int i = 0; i < 5; ++i)
+        a[i] = i;
+    a.eraseFront(2);
+    CHECK(a.size() == 3);
+    CHECK(a[0] == 2 && a[2] == 4);
+
+    a.truncate(1);
+    CHECK(a.size() == 1);
+    a.eraseFront(10);
+    CHECK(a.size() == 0);
+}
+
+TEST(DynamicArray_CacheLineAlignment)
+{
+    DynamicArray<float, CacheLineAllocator> a;
+    a.reserve(100);
+    CHECK(reinterpret_cast<std::uintptr_t>(a.data()) % CacheLineAllocator::LINE == 0);
+}
+
+TEST(LinkedList_PushPopOrder)
+{
+    PoolAllocator<Node<int>> pool;
+    {
+        LinkedList<int> list(pool);
+        for (int i = 0; i < 10; ++i)
+            list.push_front(i);
+        CHECK(list.size() == 10);
+        CHECK(pool.liveCount() == 10);
+
+        int value = -1;
+        CHECK(list.pop_front(value));
+        CHECK(value == 9);
+        CHECK(list.size() == 9);
+    }
+    CHECK(pool.liveCount() == 0);       // Destructor returned every node
+}
+
+TEST(LinkedList_MoveKeepsNodes)
+{
+    PoolAllocator<Node<int>> pool;
+    LinkedList<int> a(pool);
+    a.push_front(1);
+    a.push_front(2);
+
+    LinkedList<int> b(std::move(a));
+    CHECK(a.empty());
+    CHECK(b.size() == 2);
+    CHECK(b.getHead()->data == 2);
+    CHECK(pool.liveCount() == 2);
+}
+
+TEST(PoolAllocator_ReusesFreedBlocks)
+{
+    PoolAllocator<double, 4> pool;
+    double* blocks[4];
+    for (double*& b : blocks)
+        b = pool.allocate();
+    CHECK(pool.slabCount() == 1);
+    CHECK(pool.liveCount() == 4);
+
+    pool.deallocate(blocks[2]);
+    double* again = pool.allocate();
+    CHECK(again == blocks[2]);          // LIFO free list
+    CHECK(pool.slabCount() == 1);
+
+    pool.allocate();                    // Fifth live block needs a second slab
+    CHECK(pool.slabCount() == 2);
+    CHECK(pool.capacity() == 8);
+}
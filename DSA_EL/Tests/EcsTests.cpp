@@ -0,0 +1,93 @@
+// ---------------- ECS ----------------
+#include "TestCommon.hpp"
+#include "ECS.hpp"
+
+namespace
+{
+    struct Health { int value = 0; };
+    struct Speed { float value = 0.f; };
+}
+
+TEST(Ecs_HandleReuseBumpsGeneration)
+{
+    Registry registry;
+    Entity a = registry.create();
+    registry.destroy(a);
+    Entity b = registry.create();
+
+    CHECK(EntityId::index(a) == EntityId::index(b));
+    CHECK(EntityId::generation(b) != EntityId::generation(a));
+    CHECK(!registry.alive(a));
+    CHECK(registry.alive(b));
+    CHECK(registry.aliveCount() == 1);
+}
+
+TEST(Ecs_StaleHandleCannotTouchRecycledSlot)
+{
+    Registry registry;
+    Entity stale = registry.create();
+    registry.add<Health>(stale).value = 1;
+    registry.destroy(stale);
+
+    Entity fresh = registry.create();
+    registry.add<Health>(fresh).value = 2;
+
+    CHECK(!registry.has<Health>(stale));
+    registry.remove<Health>(stale);     // Must not strip the new owner's component
+    CHECK(registry.has<Health>(fresh));
+    CHECK(registry.get<Health>(fresh).value == 2);
+
+    registry.destroy(stale);            // Stale destroy is a no-op too
+    CHECK(registry.alive(fresh));
+}
+
+TEST(Ecs_SwapAndPopKeepsOtherComponents)
+{
+    Registry registry;
+    Entity e[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        e[i] = registry.create();
+        registry.add<Health>(e[i]).value = i * 10;
+    }
+
+    registry.remove<Health>(e[1]);
+    CHECK(!registry.has<Health>(e[1]));
+    CHECK(registry.get<Health>(e[0]).value == 0);
+    CHECK(registry.get<Health>(e[2]).value == 20);
+    CHECK(registry.get<Health>(e[3]).value == 30);
+}
+
+TEST(Ecs_ViewVisitsOnlyMatchingEntities)
+{
+    Registry registry;
+    for (int i = 0; i < 10; ++i)
+    {
+        Entity e = registry.create();
+        registry.add<Health>(e).value = i;
+        if (i % 2 == 0)
+            registry.add<Speed>(e).value = 1.f;
+    }
+
+    int visited = 0;
+    int sum = 0;
+    registry.view<Speed, Health>().each([&](Entity, Speed&, Health& h) {
+        visited++;
+        sum += h.value;
+    });
+    CHECK(visited == 5);
+    CHECK(sum == 0 + 2 + 4 + 6 + 8);
+}
+
+TEST(Ecs_ClearInvalidatesHandles)
+{
+    Registry registry;
+    Entity e = registry.create();
+    registry.add<Health>(e);
+    registry.clear();
+
+    CHECK(!registry.alive(e));
+    CHECK(registry.aliveCount() == 0);
+    Entity next = registry.create();
+    CHECK(!registry.has<Health>(next));
+}
@@ -0,0 +1,61 @@
+// ---------------- HdrHistogram ----------------
+#include "TestCommon.hpp"
+#include "HdrHistogram.hpp"
+
+TEST(HdrHistogram_ExactBelowSubBuckets)
+{
+    HdrHistogram h;
+    for (std::uint64_t v = 1; v <= 100; ++v)
+        h.record(v);
+
+    CHECK(h.count() == 100);
+    CHECK(h.min() == 1);
+    CHECK(h.max() == 100);
+    CHECK(h.percentile(50.0) == 50);
+    CHECK(h.percentile(99.0) == 99);
+    CHECK(h.percentile(100.0) == 100);
+    CHECK_NEAR(h.mean(), 50.5, 1e-9);
+}
+
+TEST(HdrHistogram_RelativeErrorWithinBucket)
+{
+    // Every value is recovered within ~1.6% (half a bucket at 64 per octave)
+    const std::uint64_t values[] = { 200, 1000, 16667, 33333, 250000, 4000000 };
+    for (std::uint64_t v : values)
+    {
+        HdrHistogram h;
+        h.record(v);
+        h.record(v * 2);                // Keeps max() from clamping the answer
+        double got = static_cast<double>(h.percentile(50.0));
+        CHECK(std::fabs(got - static_cast<double>(v)) <= v * 0.016);
+    }
+}
+
+TEST(HdrHistogram_TailPercentiles)
+{
+    HdrHistogram h;
+    for (int i = 0; i < 990; ++i)
+        h.record(16000);                // 16 ms frames
+    for (int i = 0; i < 10; ++i)
+        h.record(50000);                // 1% hitches
+
+    CHECK_NEAR(static_cast<double>(h.percentile(50.0)), 16000.0, 16000.0 * 0.016);
+    CHECK_NEAR(static_cast<double>(h.percentile(99.0)), 16000.0, 16000.0 * 0.016);
+    CHECK_NEAR(static_cast<double>(h.percentile(99.9)), 50000.0, 50000.0 * 0.016);
+}
+
+TEST(HdrHistogram_MergeAndEmpty)
+{
+    HdrHistogram a, b;
+    CHECK(a.percentile(99.0) == 0);
+    CHECK(a.min() == 0);
+
+    a.record(10);
+    b.record(20);
+    b.record(30);
+    a.merge(b);
+    CHECK(a.count() == 3);
+    CHECK(a.min() == 10);
+    CHECK(a.max() == 30);
+    CHECK(a.percentile(50.0) == 20);
+}
@@ -0,0 +1,114 @@
+// ---------------- ParticleSystem ----------------
+#include "TestCommon.hpp"
+#include "Particles.hpp"
+
+namespace
+{
+    // Particles that stay where they spawn and all live exactly `life` seconds
+    EmitterConfig still(float life)
+    {
+        EmitterConfig config;
+        config.speedMin = 0.f;
+        config.speedMax = 0.f;
+        config.gravity = 0.f;
+        config.lifeMin = life;
+        config.lifeMax = life;
+        return config;
+    }
+}
+
+TEST(Particles_SpawnsPastCapacityAreDroppedAndCounted)
+{
+    ThreadPool pool(1);
+    ParticleSystem particles(100, pool);
+    int fx = particles.addEmitter(still(1.f));
+
+    particles.burst(fx, { 0.f, 0.f }, 70);
+    particles.burst(fx, { 0.f, 0.f }, 70);
+    CHECK(particles.size() == 100);
+    CHECK(particles.getDropped() == 40);
+
+    ParticleBatch batch;
+    batch.reserve(particles.capacity());
+    particles.submit(batch);
+    CHECK(batch.size() == 100);
+
+    // Running emitters are clamped by the same budget
+    particles.clear();
+    EmitterConfig stream = still(10.f);
+    stream.rate = 1000.f;
+    particles.start(particles.addEmitter(stream), { 0.f, 0.f });
+    particles.update(0.5f);
+    CHECK(particles.size() == 100);
+    CHECK(particles.getDropped() == 40 + 400);
+}
+
+TEST(Particles_UpdateCompactsSurvivorsAcrossChunks)
+{
+    ThreadPool pool(4);
+    const int capacity = ParticleSystem::CHUNK_SIZE * 3;
+    ParticleSystem particles(capacity, pool);
+    int shortFx = particles.addEmitter(still(0.05f));
+    int longFx = particles.addEmitter(still(1.f));
+
+    // Interleaved runs, so every chunk holds both dying and surviving particles
+    int survivors = 0;
+    while (particles.size() + 1000 <= capacity)
+    {
+        particles.burst(shortFx, { 0.f, 0.f }, 700);
+        particles.burst(longFx, { 0.f, 0.f }, 300);
+        survivors += 300;
+    }
+    CHECK(particles.size() > ParticleSystem::CHUNK_SIZE * 2);
+
+    particles.update(0.1f);
+    CHECK(particles.size() == survivors);
+    CHECK(particles.getDropped() == 0);
+
+    particles.update(0.5f);
+    CHECK(particles.size() == survivors);
+    particles.update(0.5f);
+    CHECK(particles.size() == 0);
+
+    ParticleBatch batch;
+    particles.submit(batch);
+    CHECK(batch.size() == 0);
+}
+
+TEST(Particles_StaleAndInvalidHandlesAreIgnored)
+{
+    ThreadPool pool(1);
+    ParticleSystem particles(1000, pool);
+    EmitterConfig stream = still(1.f);
+    stream.rate = 100.f;
+    int fx = particles.addEmitter(stream);
+
+    int first = particles.start(fx, { 0.f, 0.f });
+    CHECK(particles.isRunning(first));
+    particles.stop(first);
+    CHECK(!particles.isRunning(first));
+
+    int second = particles.start(fx, { 0.f, 0.f });   // Reuses the freed slot
+    CHECK(second != first);
+    CHECK(particles.isRunning(second));
+
+    particles.stop(first);                              // Stale: the slot has a new owner
+    particles.moveEmitter(first, { 500.f, 500.f });
+    particles.stop(-1);
+    particles.stop(ParticleSystem::MAX_RUNNING);        // Slot index out of range
+    particles.moveEmitter(ParticleSystem::MAX_RUNNING, { 0.f, 0.f });
+    CHECK(particles.isRunning(second));
+    CHECK(!particles.isRunning(ParticleSystem::MAX_RUNNING));
+
+    particles.update(0.1f);
+    CHECK(particles.size() == 10);
+
+    particles.clear();                                  // Ends every handle too
+    CHECK(!particles.isRunning(second));
+    CHECK(particles.size() == 0);
+
+    for (int i = 0; i < ParticleSystem::MAX_RUNNING; ++i)
+        particles.start(fx, { 0.f, 0.f });
+    CHECK(particles.start(fx, { 0.f, 0.f }) == -1);
+    CHECK(particles.start(ParticleSystem::MAX_CONFIGS, { 0.f, 0.f }) == -1);
+}
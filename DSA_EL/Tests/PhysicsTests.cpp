@@ -0,0 +1,156 @@
+// ---------------- Platform physics ----------------
+#include "TestCommon.hpp"
+#include "Physics.hpp"
+
+namespace
+{
+    const sf::Vector2f BODY_SIZE(30.f, 40.f);
+
+    sf::FloatRect bodyAt(float x, float y)
+    {
+        return { { x, y }, BODY_SIZE };
+    }
+
+    Physics::Contacts step(sf::FloatRect& body, sf::Vector2f& velocity, float dt,
+                           const Physics::Platform* platforms, int count)
+    {
+        sf::FloatRect to(body.position + velocity * dt, body.size);
+        Physics::Contacts contacts = Physics::resolve(body, to, velocity, platforms, count);
+        body = to;
+        return contacts;
+    }
+}
+
+TEST(Physics_LandsFlushOnTop)
+{
+    Physics::Platform floor{ { { 0.f, 100.f }, { 200.f, 20.f } } };
+    sf::FloatRect body = bodyAt(50.f, 40.f);
+    sf::Vector2f velocity(0.f, 600.f);
+
+    Physics::Contacts c = step(body, velocity, 0.1f, &floor, 1);   // Would end 40 px inside
+    CHECK(c.grounded());
+    CHECK(c.ground == 0);
+    CHECK(body.position.y == 100.f - BODY_SIZE.y);
+    CHECK(velocity.y == 0.f);
+}
+
+TEST(Physics_RestingBodyGroundedAtAnyRate)
+{
+    // Gravity-only steps at 1000 Hz move ~0.002 px, less than the skin gap
+    Physics::Platform floor{ { { -100.f, 100.f }, { 400.f, 20.f } } };
+    const float GRAVITY = 2200.f;
+    const float rates[] = { 60.f, 144.f, 1000.f, 2000.f };
+
+    for (float hz : rates)
+    {
+        float dt = 1.f / hz;
+        sf::FloatRect body = bodyAt(50.f, 100.f - BODY_SIZE.y);
+        sf::Vector2f velocity;
+        int frames = static_cast<int>(hz);         // One second
+        int grounded = 0;
+
+        for (int f = 0; f < frames; ++f)
+        {
+            velocity.y += GRAVITY * dt;
+            grounded += step(body, velocity, dt, &floor, 1).grounded();
+        }
+
+        CHECK(grounded == frames);
+        CHECK(body.position.y == 100.f - BODY_SIZE.y);
+        CHECK(velocity.y == 0.f);
+    }
+}
+
+TEST(Physics_JumpLeavesRestingContact)
+{
+    Physics::Platform floor{ { { -100.f, 100.f }, { 400.f, 20.f } } };
+    sf::FloatRect body = bodyAt(50.f, 100.f - BODY_SIZE.y);
+    sf::Vector2f velocity(0.f, -750.f);
+
+    Physics::Contacts c = step(body, velocity, 1.f / 1000.f, &floor, 1);
+    CHECK(!c.grounded());
+    CHECK(body.position.y < 100.f - BODY_SIZE.y);
+    CHECK(velocity.y == -750.f);
+}
+
+TEST(Physics_SideHitStopsAndSlides)
+{
+    Physics::Platform wall{ { { 100.f, 0.f }, { 20.f, 200.f } } };
+    sf::FloatRect body = bodyAt(50.f, 50.f);
+    sf::Vector2f velocity(400.f, 100.f);
+
+    Physics::Contacts c = step(body, velocity, 0.1f, &wall, 1);
+    CHECK(c.wall == 0);
+    CHECK(c.wallNormal == -1.f);
+    CHECK(!c.grounded());
+    CHECK(body.position.x == 100.f - BODY_SIZE.x);
+    CHECK_NEAR(body.position.y, 60.f, 1e-4f);       // y keeps its full step
+    CHECK(velocity.x == 0.f);
+}
+
+TEST(Physics_CeilingStopsRise)
+{
+    Physics::Platform ceiling{ { { 0.f, 0.f }, { 200.f, 20.f } } };
+    sf::FloatRect body = bodyAt(50.f, 30.f);
+    sf::Vector2f velocity(0.f, -500.f);
+
+    Physics::Contacts c = step(body, velocity, 0.1f, &ceiling, 1);
+    CHECK(c.ceiling == 0);
+    CHECK(body.position.y == 20.f);
+    CHECK(velocity.y == 0.f);
+}
+
+TEST(Physics_OneWayOnlyFromAbove)
+{
+    Physics::Platform ledge{ { { 0.f, 100.f }, { 200.f, 10.f } }, Physics::PlatformOneWay };
+
+    // Jumping up through it from below
+    sf::FloatRect body = bodyAt(50.f, 120.f);
+    sf::Vector2f velocity(0.f, -600.f);
+    Physics::Contacts c = step(body, velocity, 0.1f, &ledge, 1);
+    CHECK(c.ceiling < 0);
+    CHECK_NEAR(body.position.y, 60.f, 1e-4f);
+
+    // Running into its side
+    body = bodyAt(-40.f, 80.f);
+    velocity = { 300.f, 0.f };
+    c = step(body, velocity, 0.1f, &ledge, 1);
+    CHECK(c.wall < 0);
+
+    // Falling onto it from above
+    body = bodyAt(50.f, 0.f);
+    velocity = { 0.f, 900.f };
+    c = step(body, velocity, 0.1f, &ledge, 1);
+    CHECK(c.grounded());
+    CHECK(body.position.y == 100.f - BODY_SIZE.y);
+}
+
+TEST(Physics_EarliestOfSeveralPlatformsWins)
+{
+    const Physics::Platform platforms[3] = {
+        { { { 0.f, 300.f }, { 200.f, 20.f } } },
+        { { { 0.f, 150.f }, { 200.f, 20.f } } },        // Nearer, listed second
+        { { { 500.f, 100.f }, { 50.f, 20.f } } },       // Out of the way
+    };
+    sf::FloatRect body = bodyAt(50.f, 0.f);
+    sf::Vector2f velocity(0.f, 4000.f);
+
+    Physics::Contacts c = step(body, velocity, 0.1f, platforms, 3);
+    CHECK(c.ground == 1);
+    CHECK(body.position.y == 150.f - BODY_SIZE.y);
+}
+
+TEST(Physics_RangeXFindsTouchingPlatforms)
+{
+    Physics::Platform sorted[100];
+    for (int i = 0; i < 100; ++i)
+        sorted[i] = { { { i * 100.f, 0.f }, { 50.f, 10.f } } };
+
+    int begin = 0, end = 0;
+    Physics::rangeX(sorted, 100, 1020.f, 1260.f, 50.f, begin, end);
+    CHECK(begin == 10);     // 1000..1050 reaches minX
+    CHECK(end == 13);       // 1300 starts past maxX
+
+    Physics::rangeX(sorted, 100, -500.f, -100.f, 50.f, begin, end);
+    CHECK(begin == end);
+}
@@ -0,0 +1,138 @@
+// ---------------- SceneStack ----------------
+#include "TestCommon.hpp"
+#include "Scene.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace
+{
+    // Appends "name:event " to a shared journal for every lifecycle call
+    class Probe : public Scene
+    {
+    public:
+        Probe(SceneStack& stack, const char* name, std::string& journal, bool passThrough = false)
+            : Scene(stack), m_name(name), m_journal(journal), m_passThrough(passThrough) {}
+
+        void enter() override { note("enter"); }
+        void exit() override { note("exit"); }
+        void suspend() override { note("suspend"); }
+        void resume() override { note("resume"); }
+
+        void update(float) override
+        {
+            note("update");
+            if (onUpdate)
+                onUpdate();
+        }
+
+        void render(sf::RenderTarget&) override {}
+
+        bool updatesBelow() const override { return m_passThrough; }
+        const char* name() const override { return m_name; }
+
+        std::function<void()> onUpdate;
+
+    private:
+        void note(const char* event) { m_journal += std::string(m_name) + ":" + event + " "; }
+
+        const char* m_name;
+        std::string& m_journal;
+        bool m_passThrough;
+    };
+
+    // SceneStack only hands its Window on to scenes, and probes never ask
+    // for it, so the tests run headless without opening one
+    Window& headlessWindow()
+    {
+        alignas(Window) static unsigned char storage[sizeof(Window)];
+        return *reinterpret_cast<Window*>(storage);
+    }
+
+    std::unique_ptr<Scene> probe(SceneStack& stack, const char* name, std::string& journal, bool passThrough = false)
+    {
+        return std::make_unique<Probe>(stack, name, journal, passThrough);
+    }
+}
+
+TEST(SceneStack_ChangesWaitForApplyPending)
+{
+    std::string journal;
+    SceneStack stack(headlessWindow(), nullptr);
+
+    stack.push(probe(stack, "A", journal));
+    CHECK(stack.empty());
+    CHECK(stack.applyPending());
+    CHECK(stack.size() == 1);
+    CHECK(std::string(stack.state()) == "A");
+    CHECK(!stack.applyPending());                   // Nothing queued
+
+    // A scene replacing itself from inside its own update()
+    Probe* a = static_cast<Probe*>(stack.top());
+    a->onUpdate = [&]() {
+        stack.pop();
+        stack.push(probe(stack, "B", journal));
+    };
+    stack.update(0.f);
+    CHECK(stack.top() == a);                        // Still running until the frame boundary
+    journal.clear();
+    CHECK(stack.applyPending());
+    CHECK(journal == "A:exit B:enter ");
+
+    journal.clear();
+    stack.push(probe(stack, "C", journal));
+    stack.applyPending();
+    stack.pop();
+    stack.applyPending();
+    stack.clear();
+    stack.applyPending();
+    CHECK(journal == "B:suspend C:enter C:exit B:resume B:exit ");
+    CHECK(stack.empty());
+}
+
+TEST(SceneStack_OverlaysUpdateTheSceneBelowFirst)
+{
+    std::string journal;
+    SceneStack stack(headlessWindow(), nullptr);
+    stack.push(probe(stack, "Game", journal));
+    stack.push(probe(stack, "Overlay", journal, true));
+    stack.push(probe(stack, "Modal", journal));
+    stack.applyPending();
+
+    journal.clear();
+    stack.update(0.f);
+    CHECK(journal == "Modal:update ");              // Modal stops the walk down
+
+    stack.pop();
+    stack.applyPending();
+    journal.clear();
+    stack.update(0.f);
+    CHECK(journal == "Game:update Overlay:update ");
+}
+
+TEST(SceneStack_OverflowingChangesAreReported)
+{
+    std::string journal;
+    SceneStack stack(headlessWindow(), nullptr);
+
+    // Pending queue: MAX_SCENES * 2 changes per frame
+    bool queued = true;
+    for (int i = 0; i < SceneStack::MAX_SCENES * 2; ++i)
+        queued = stack.pop() && queued;
+    CHECK(queued);
+    CHECK(!stack.push(probe(stack, "Dropped", journal)));
+    CHECK(stack.applyPending());                    // Pops on an empty stack are harmless
+    CHECK(stack.empty());
+    CHECK(journal.empty());                         // The dropped scene never entered
+
+    // Scene stack: a push past MAX_SCENES is dropped and the top resumes
+    static const char* names[] = { "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8" };
+    static_assert(sizeof(names) / sizeof(names[0]) == SceneStack::MAX_SCENES + 1, "one name per push");
+    for (const char* name : names)
+        CHECK(stack.push(probe(stack, name, journal)));
+    stack.applyPending();
+    CHECK(stack.size() == SceneStack::MAX_SCENES);
+    CHECK(std::string(stack.state()) == "s7");
+    const std::string tail = "s7:suspend s7:resume ";
+    CHECK(journal.size() >= tail.size() && journal.compare(journal.size() - tail.size(), tail.size(), tail) == 0);
+}
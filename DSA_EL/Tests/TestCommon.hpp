@@ -0,0 +1,67 @@
+#pragma once
+#include <cmath>
+#include <cstdio>
+
+// ================= TEST HARNESS =================
+// Minimal self-registering unit tests for DSA_Tests (no framework
+// dependency). TEST(name) defines a case; CHECK / CHECK_NEAR record a
+// failure with its location and let the case carry on, so one run reports
+// every broken expectation.
+namespace Test
+{
+    using Fn = void (*)();
+
+    struct Case
+    {
+        const char* name;
+        Fn fn;
+        Case* next;
+    };
+
+    inline Case*& registry()
+    {
+        static Case* head = nullptr;
+        return head;
+    }
+
+    inline int& failures()
+    {
+        static int count = 0;
+        return count;
+    }
+
+    struct Registrar
+    {
+        Case entry;
+
+        Registrar(const char* name, Fn fn) : entry{ name, fn, nullptr }
+        {
+            // Append, so cases run in definition order within a file
+            Case** tail = &registry();
+            while (*tail)
+                tail = &(*tail)->next;
+            *tail = &entry;
+        }
+    };
+
+    inline void fail(const char* file, int line, const char* expression)
+    {
+        std::printf("  FAIL %s:%d: %s\n", file, line, expression);
+        failures()++;
+    }
+}
+
+#define TEST_CONCAT_INNER(a, b) a##b
+#define TEST_CONCAT(a, b) TEST_CONCAT_INNER(a, b)
+
+#define TEST(name)                                                              \
+    static void name();                                                         \
+    static Test::Registrar TEST_CONCAT(name, _registrar)(#name, &name);         \
+    static void name()
+
+#define CHECK(expression)                                                       \
+    do { if (!(expression)) Test::fail(__FILE__, __LINE__, #expression); } while (0)
+
+#define CHECK_NEAR(a, b, tolerance)                                             \
+    do { if (std::fabs((a) - (b)) > (tolerance))                                \
+        Test::fail(__FILE__, __LINE__, #a " ~= " #b); } while (0)
@@ -0,0 +1,32 @@
+// ================= UNIT TESTS =================
+// Runs every TEST() linked into DSA_Tests; exits non-zero when any CHECK
+// failed (CTest reads the exit code).
+//
+//   DSA_Tests [filter]      only cases whose name contains `filter`
+
+#include "TestCommon.hpp"
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int run = 0;
+    int failedCases = 0;
+
+    for (Test::Case* c = Test::registry(); c; c = c->next)
+    {
+        if (filter && !std::strstr(c->name, filter))
+            continue;
+
+        int before = Test::failures();
+        c->fn();
+        run++;
+        bool passed = Test::failures() == before;
+        if (!passed)
+            failedCases++;
+        std::printf("[TEST] %-40s %s\n", c->name, passed ? "ok" : "FAILED");
+    }
+
+    std::printf("[TEST] %d cases, %d failed, %d checks failed\n", run, failedCases, Test::failures());
+    return failedCases == 0 ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+// ---------------- SceneNode / StackLayout ----------------
+#include "TestCommon.hpp"
+#include "Layout.hpp"
+
+namespace
+{
+    // Interactive rectangle that counts its measure passes
+    class Box : public SceneNode
+    {
+    public:
+        explicit Box(sf::Vector2f size) : m_size(size) {}
+
+        void setSize(sf::Vector2f size)
+        {
+            m_size = size;
+            markBoundsDirty();
+            markLayoutDirty();
+        }
+
+        sf::FloatRect getLocalBounds() const override { return { { 0.f, 0.f }, m_size }; }
+        bool isInteractive() const override { return true; }
+
+        int measures = 0;
+
+    protected:
+        sf::Vector2f measure() override
+        {
+            ++measures;
+            return m_size;
+        }
+
+    private:
+        sf::Vector2f m_size;
+    };
+}
+
+TEST(SceneNode_MoveUpdatesSubtreeTransformsAndAncestorBounds)
+{
+    SceneNode root;
+    SceneNode group;
+    Box child({ 10.f, 10.f });
+    root.addChild(&group);
+    group.addChild(&child);
+    child.setPosition({ 5.f, 5.f });
+    CHECK(root.getSubtreeBounds() == sf::FloatRect({ 5.f, 5.f }, { 10.f, 10.f }));
+
+    // Moving the group dirties the child's cached transform and the root's bounds
+    group.setPosition({ 100.f, 50.f });
+    CHECK(child.getWorldTransform().transformPoint({ 0.f, 0.f }) == sf::Vector2f(105.f, 55.f));
+    CHECK(child.getBounds() == sf::FloatRect({ 105.f, 55.f }, { 10.f, 10.f }));
+    CHECK(root.getSubtreeBounds() == sf::FloatRect({ 105.f, 55.f }, { 10.f, 10.f }));
+
+    // Content changes propagate up the same way
+    child.setSize({ 20.f, 30.f });
+    CHECK(root.getSubtreeBounds() == sf::FloatRect({ 105.f, 55.f }, { 20.f, 30.f }));
+
+    child.setVisible(false);
+    CHECK(root.getSubtreeBounds().size == sf::Vector2f(0.f, 0.f));
+}
+
+TEST(SceneNode_HitTestPicksTopmostVisibleInteractiveNode)
+{
+    SceneNode root;
+    Box back({ 100.f, 100.f });
+    Box front({ 50.f, 50.f });
+    root.addChild(&back);
+    root.addChild(&front);
+    front.setPosition({ 25.f, 25.f });
+
+    CHECK(root.hitTest({ 30.f, 30.f }) == &front);      // Added last, drawn on top
+    CHECK(root.hitTest({ 10.f, 10.f }) == &back);
+    CHECK(root.hitTest({ 200.f, 200.f }) == nullptr);   // Outside the subtree bounds
+
+    back.setZOrder(1);
+    CHECK(root.hitTest({ 30.f, 30.f }) == &back);
+
+    back.setVisible(false);
+    CHECK(root.hitTest({ 30.f, 30.f }) == &front);
+    CHECK(root.hitTest({ 10.f, 10.f }) == nullptr);     // The root itself is not interactive
+}
+
+TEST(StackLayout_CachesUntilAChildChanges)
+{
+    UIRoot root;
+    StackLayout column(Orientation::Vertical, 10.f, Align::Start);
+    Box a({ 50.f, 20.f });
+    Box b({ 30.f, 10.f });
+    Box c({ 40.f, 30.f });
+    column.setAnchor(Anchor::TopLeft);
+    column.addChild(&a);
+    column.addChild(&b);
+    column.addChild(&c);
+    root.addChild(&column);
+
+    CHECK(root.layout({ 800.f, 600.f }));
+    CHECK(column.getDesiredSize() == sf::Vector2f(50.f, 80.f));
+    CHECK(a.getPosition() == sf::Vector2f(0.f, 0.f));
+    CHECK(b.getPosition() == sf::Vector2f(0.f, 30.f));
+    CHECK(c.getPosition() == sf::Vector2f(0.f, 50.f));
+    CHECK(a.measures == 1 && b.measures == 1 && c.measures == 1);
+
+    CHECK(!root.layout({ 800.f, 600.f }));             // Nothing changed
+    CHECK(a.measures == 1 && b.measures == 1 && c.measures == 1);
+
+    // Only the changed child re-measures; the ones after it move
+    b.setSize({ 30.f, 40.f });
+    CHECK(root.layout({ 800.f, 600.f }));
+    CHECK(a.measures == 1 && b.measures == 2 && c.measures == 1);
+    CHECK(column.getDesiredSize() == sf::Vector2f(50.f, 110.f));
+    CHECK(c.getPosition() == sf::Vector2f(0.f, 80.f));
+
+    b.setVisible(false);
+    CHECK(root.layout({ 800.f, 600.f }));
+    CHECK(column.getDesiredSize() == sf::Vector2f(50.f, 60.f));
+    CHECK(c.getPosition() == sf::Vector2f(0.f, 30.f));
+}
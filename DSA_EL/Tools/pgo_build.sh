@@ -0,0 +1,140 @@
+#!/usr/bin/env bash
+# ================= PGO + LTO BUILD PIPELINE =================
+# 1. Release and Release+LTO reference builds
+# 2. Instrumented build, trained on the ScenarioBench suite
+# 3. The same tree rebuilt with the collected profile and LTO
+# 4. Every benchmark on all three builds, best of BENCH_RUNS, with speedups:
+#    ScenarioBench (the training workload) plus the held-out ParticleBench,
+#    CollisionBench and ContainerBench, so the gain isn't only measured on
+#    the data the profile came from
+#
+#   Tools/pgo_build.sh [build-root] [extra cmake args...]
+#
+# Environment:
+#   TRAIN_ARGS     ScenarioBench arguments for the training run (default: --quick)
+#   BENCH_ARGS     ScenarioBench arguments for measurement (default: full suite)
+#   HELDOUT_ARGS   arguments for the held-out benchmarks (default: --quick)
+#   BENCH_RUNS     measurement repetitions per build (default: 5)
+#   JOBS           parallel build jobs (default: nproc)
+#   BUILD_TARGETS  space-separated targets to build (default: all)
+#   LLVM_PROFDATA  profile merger for Clang builds (default: llvm-profdata)
+#
+# GCC names profile files after the object paths, so the instrumented and
+# optimised builds share one build directory and are told apart by DSA_PGO.
+set -euo pipefail
+
+SOURCE_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+BUILD_ROOT="${1:-$SOURCE_DIR/../build-pgo}"
+shift $(( $# > 0 ? 1 : 0 ))
+EXTRA_ARGS=("$@")
+
+TRAIN_ARGS="${TRAIN_ARGS:---quick}"
+BENCH_ARGS="${BENCH_ARGS:-}"
+HELDOUT_ARGS="${HELDOUT_ARGS:---quick}"
+BENCH_RUNS="${BENCH_RUNS:-5}"
+JOBS="${JOBS:-$(nproc 2>/dev/null || echo 4)}"
+TARGET_ARGS=()
+for target in ${BUILD_TARGETS:-}; do
+    TARGET_ARGS+=(--target "$target")
+done
+LLVM_PROFDATA="${LLVM_PROFDATA:-llvm-profdata}"
+
+mkdir -p "$BUILD_ROOT"
+BUILD_ROOT="$(cd "$BUILD_ROOT" && pwd)"
+PROFILE_DIR="$BUILD_ROOT/pgo/profile"
+
+log() { echo "[PGO] $*"; }
+
+configure_and_build() {
+    local dir="$1"; shift
+    local log="$dir.build.log"
+    if ! { cmake -S "$SOURCE_DIR" -B "$dir" -DCMAKE_BUILD_TYPE=Release "${EXTRA_ARGS[@]}" "$@" &&
+           cmake --build "$dir" -j "$JOBS" "${TARGET_ARGS[@]}"; } > "$log" 2>&1; then
+        tail -n 30 "$log"
+        log "Build failed, see $log"
+        exit 1
+    fi
+}
+
+# Best score per case over BENCH_RUNS runs -> "case score" lines. Scores
+# are higher-is-better: ticks/sec (Scenario), Mparticles/sec (Particle),
+# ops/sec (Collision), ops per microsecond (Container)
+measure() {
+    local suite="$1" bench="$2" args="$3"
+    for ((run = 0; run < BENCH_RUNS; ++run)); do
+        # shellcheck disable=SC2086
+        "$bench" --csv $args 2>/dev/null | tail -n +2
+    done | awk -F, -v suite="$suite" '
+        suite == "ScenarioBench"  { if (NF < 9) next; key = $1; score = $3 }
+        suite == "ParticleBench"  { key = "threads-" $2; score = $6 }
+        suite == "CollisionBench" { key = $1 "/" $2 "/" $3 "/" $4; score = $6 }
+        suite == "ContainerBench" { if ($5 <= 0) next; key = $1 "/" $2 "/" $3 "/" $4; score = 1000 / $5 }
+        { gsub(/ /, "_", key)
+          if (score > best[key]) best[key] = score
+          if (!(key in seen)) { seen[key] = 1; order[++n] = key } }
+        END { for (i = 1; i <= n; ++i) print order[i], best[order[i]] }'
+}
+
+# ---------------- Reference builds ----------------
+log "Release build"
+configure_and_build "$BUILD_ROOT/release" -DDSA_PGO=OFF -DDSA_ENABLE_LTO=OFF
+log "Release + LTO build"
+configure_and_build "$BUILD_ROOT/lto" -DDSA_PGO=OFF -DDSA_ENABLE_LTO=ON
+
+# ---------------- Instrumented build + training ----------------
+log "Instrumented build"
+rm -rf "$PROFILE_DIR"
+configure_and_build "$BUILD_ROOT/pgo" -DDSA_PGO=GENERATE -DDSA_PGO_DIR="$PROFILE_DIR" -DDSA_ENABLE_LTO=OFF
+
+log "Training: ScenarioBench $TRAIN_ARGS"
+# shellcheck disable=SC2086
+LLVM_PROFILE_FILE="$PROFILE_DIR/%p.profraw" "$BUILD_ROOT/pgo/ScenarioBench" $TRAIN_ARGS > "$BUILD_ROOT/pgo.training.log" 2>&1
+
+# Clang writes raw profiles that must be merged; GCC's .gcda files are used as-is
+if ls "$PROFILE_DIR"/*.profraw > /dev/null 2>&1; then
+    log "Merging Clang profiles"
+    "$LLVM_PROFDATA" merge -output="$PROFILE_DIR/default.profdata" "$PROFILE_DIR"/*.profraw
+fi
+
+# ---------------- Optimised build ----------------
+log "Profile-optimised + LTO build"
+configure_and_build "$BUILD_ROOT/pgo" -DDSA_PGO=USE -DDSA_PGO_DIR="$PROFILE_DIR" -DDSA_ENABLE_LTO=ON
+
+# ---------------- Report ----------------
+SUITES=(ScenarioBench ParticleBench CollisionBench ContainerBench)
+REPORT="$BUILD_ROOT/pgo_report.csv"
+echo "suite,case,trained,release,lto,pgo_lto,lto_speedup,pgo_lto_speedup" > "$REPORT"
+
+for suite in "${SUITES[@]}"; do
+    args="$HELDOUT_ARGS"
+    trained=no
+    if [[ "$suite" == ScenarioBench ]]; then
+        args="$BENCH_ARGS"
+        trained=yes
+    fi
+
+    log "Measuring $suite ($BENCH_RUNS runs per build)"
+    for build in release lto pgo; do
+        measure "$suite" "$BUILD_ROOT/$build/$suite" "$args" > "$BUILD_ROOT/$build.$suite.score"
+    done
+
+    awk -v suite="$suite" -v trained="$trained" \
+        'FNR == 1 { file++ } { score[file, $1] = $2; if (file == 1) order[++n] = $1 }
+         END { for (i = 1; i <= n; ++i) { c = order[i]; r = score[1, c]; l = score[2, c]; p = score[3, c]
+               printf "%s,%s,%s,%.3f,%.3f,%.3f,%.3f,%.3f\n", suite, c, trained, r, l, p, (r > 0 ? l / r : 0), (r > 0 ? p / r : 0) } }' \
+        "$BUILD_ROOT/release.$suite.score" "$BUILD_ROOT/lto.$suite.score" "$BUILD_ROOT/pgo.$suite.score" >> "$REPORT"
+done
+
+# Per-suite geometric mean of the per-case speedups; the held-out line is
+# the number to quote, the trained line shows how much of it is overfit
+echo
+printf "%-16s %7s %7s %9s %9s\n" suite trained cases lto pgo+lto
+tail -n +2 "$REPORT" | awk -F, '
+    $7 > 0 && $8 > 0 { n[$1]++; trained[$1] = $3; l[$1] += log($7); p[$1] += log($8)
+                       if (!($1 in seen)) { seen[$1] = 1; order[++k] = $1 }
+                       if ($3 == "no") { hn++; hl += log($7); hp += log($8) } }
+    END { for (i = 1; i <= k; ++i) { s = order[i]
+              printf "%-16s %7s %7d %8.3fx %8.3fx\n", s, trained[s], n[s], exp(l[s] / n[s]), exp(p[s] / n[s]) }
+          if (hn > 0) printf "%-16s %7s %7d %8.3fx %8.3fx\n", "held-out", "no", hn, exp(hl / hn), exp(hp / hn) }'
+echo
+log "Report written to $REPORT (per-case rows)"